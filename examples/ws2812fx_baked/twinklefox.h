@@ -0,0 +1,336 @@
+// TwinkleFOX effect baked by wfxbake: 30 LEDs, speed 1000, options 0x00, colors 0xff0000 0x000000 0x000000
+// 128 frames, 5311 bytes. Play it with the Baked custom effect (custom/Baked.h).
+const uint8_t twinklefox[] PROGMEM = {
+  0x57, 0x46, 0x58, 0x43, 0x01, 0x01, 0x03, 0x00, 0x1e, 0x00, 0x80, 0x00, 0x00, 0x00, 0x72, 0x00,
+  0x0a, 0x00, 0x00, 0x10, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xba, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x77, 0x00, 0x00, 0xff, 0x00, 0x00, 0x68, 0x00,
+  0x00, 0x6e, 0x00, 0x00, 0x16, 0x00, 0x00, 0xb1, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x50, 0x00, 0x00,
+  0xef, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x24, 0x00, 0x00, 0xbf, 0x00, 0x00, 0xca, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x56, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x12, 0x00, 0x00, 0x06, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0xd1, 0x00, 0x00, 0x15, 0x00, 0x00, 0xae, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x47, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xa6, 0x00, 0x00, 0xf1,
+  0x00, 0x00, 0xf2, 0x00, 0x00, 0x42, 0x00, 0x00, 0x96, 0x00, 0x00, 0xb4, 0x00, 0x00, 0xa8, 0x00,
+  0x00, 0x1e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x62, 0x00, 0x00, 0x93, 0x00, 0x00, 0x1c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x2b, 0x00, 0x00, 0x99, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x44, 0x00, 0x00, 0xf5, 0x00,
+  0x00, 0xfb, 0x00, 0x00, 0x65, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x84, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x87, 0x00, 0x00, 0x04, 0x00, 0x00, 0xab, 0x00, 0x00, 0x13, 0x00, 0x00, 0x8d,
+  0x00, 0x00, 0xe3, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x5e, 0x00,
+  0x00, 0x7a, 0x00, 0x00, 0x37, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x80, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x32, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x74, 0x00, 0x00, 0x35,
+  0x00, 0x00, 0xcf, 0x00, 0x00, 0x53, 0x00, 0x00, 0x59, 0x00, 0x00, 0x71, 0x00, 0x00, 0x2d, 0x00,
+  0x00, 0x26, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc7, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0xe9, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xdd,
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x22, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xec, 0x00,
+  0x00, 0xd6, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xee, 0x00, 0x00, 0xd8, 0x00, 0x00,
+  0xf9, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x00,
+  0x11, 0x12, 0x13, 0x14, 0x14, 0x01, 0x15, 0x16, 0x17, 0x05, 0x12, 0x00, 0x01, 0x1f, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x42, 0x18, 0x19, 0x1a, 0x00, 0x59, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21,
+  0x22, 0x23, 0x24, 0x25, 0x22, 0x26, 0x03, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e,
+  0x2c, 0x2c, 0x05, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x2f, 0x30, 0x31, 0x30, 0x32,
+  0x02, 0x33, 0x34, 0x35, 0x07, 0x0f, 0x36, 0x15, 0x37, 0x38, 0x39, 0x3a, 0x05, 0x3b, 0x3c, 0x3d,
+  0x3e, 0x3f, 0x40, 0x12, 0x0b, 0x41, 0x1a, 0x15, 0x19, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x40, 0x02, 0x00, 0x40, 0x42, 0x00, 0x59, 0x37, 0x27, 0x28, 0x43, 0x05, 0x32, 0x39, 0x44, 0x03,
+  0x45, 0x46, 0x47, 0x48, 0x2f, 0x09, 0x49, 0x27, 0x3f, 0x4a, 0x39, 0x27, 0x4b, 0x4b, 0x12, 0x30,
+  0x42, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x4c, 0x19, 0x03, 0x15, 0x4b, 0x4a, 0x49,
+  0x37, 0x03, 0x45, 0x4d, 0x4e, 0x15, 0x4f, 0x07, 0x4d, 0x50, 0x51, 0x00, 0x4a, 0x1d, 0x35, 0x3d,
+  0x51, 0x21, 0x3c, 0x41, 0x0b, 0x52, 0x31, 0x15, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d,
+  0x1f, 0x01, 0x15, 0x4e, 0x21, 0x53, 0x53, 0x41, 0x2c, 0x2d, 0x40, 0x03, 0x23, 0x54, 0x1b, 0x55,
+  0x3b, 0x3c, 0x50, 0x56, 0x00, 0x57, 0x35, 0x54, 0x49, 0x2e, 0x2d, 0x27, 0x35, 0x30, 0x01, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x58, 0x2b, 0x00, 0x19, 0x47, 0x3e, 0x59, 0x54, 0x5a, 0x4d,
+  0x5b, 0x5c, 0x0c, 0x0a, 0x5d, 0x40, 0x5e, 0x5f, 0x10, 0x60, 0x03, 0x51, 0x31, 0x45, 0x1d, 0x17,
+  0x16, 0x57, 0x51, 0x03, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5c, 0x3d, 0x40, 0x1c, 0x5c,
+  0x5b, 0x06, 0x3c, 0x2d, 0x58, 0x61, 0x2b, 0x61, 0x5b, 0x21, 0x34, 0x36, 0x62, 0x06, 0x63, 0x50,
+  0x05, 0x02, 0x30, 0x24, 0x56, 0x43, 0x22, 0x3c, 0x4a, 0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0x5c, 0x53, 0x39, 0x12, 0x23, 0x44, 0x64, 0x58, 0x0f, 0x49, 0x19, 0x0c, 0x55, 0x4d, 0x0f,
+  0x0d, 0x5b, 0x09, 0x65, 0x56, 0x09, 0x2f, 0x1a, 0x15, 0x34, 0x60, 0x32, 0x47, 0x08, 0x3f, 0x00,
+  0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x5f, 0x21, 0x4c, 0x66, 0x19, 0x60, 0x67, 0x47,
+  0x06, 0x03, 0x01, 0x16, 0x0f, 0x39, 0x24, 0x68, 0x00, 0x4b, 0x3a, 0x06, 0x3b, 0x51, 0x31, 0x2c,
+  0x1b, 0x50, 0x69, 0x55, 0x49, 0x2a, 0x00, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x33,
+  0x54, 0x67, 0x01, 0x03, 0x48, 0x27, 0x40, 0x63, 0x23, 0x23, 0x4b, 0x0a, 0x4d, 0x37, 0x2b, 0x00,
+  0x4c, 0x09, 0x33, 0x6a, 0x3c, 0x42, 0x12, 0x46, 0x09, 0x1e, 0x36, 0x3e, 0x14, 0x30, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x29, 0x45, 0x3c, 0x44, 0x15, 0x09, 0x4c, 0x68, 0x50, 0x68,
+  0x19, 0x17, 0x4f, 0x40, 0x45, 0x61, 0x00, 0x4c, 0x3b, 0x49, 0x64, 0x5f, 0x03, 0x27, 0x25, 0x3b,
+  0x6b, 0x68, 0x1d, 0x11, 0x15, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x44, 0x6c, 0x24, 0x53,
+  0x0c, 0x66, 0x00, 0x49, 0x5a, 0x0c, 0x09, 0x39, 0x15, 0x69, 0x37, 0x5b, 0x4f, 0x0c, 0x00, 0x4c,
+  0x60, 0x59, 0x29, 0x06, 0x15, 0x3c, 0x3b, 0x6a, 0x6d, 0x61, 0x13, 0x48, 0x42, 0x01, 0x1f, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x4f, 0x64, 0x34, 0x28, 0x61, 0x2b, 0x48, 0x12, 0x66, 0x26, 0x0b, 0x30,
+  0x6d, 0x0d, 0x2b, 0x54, 0x44, 0x00, 0x4c, 0x14, 0x58, 0x5f, 0x65, 0x00, 0x49, 0x09, 0x64, 0x04,
+  0x44, 0x56, 0x09, 0x19, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x56, 0x63, 0x1b, 0x1d, 0x2b,
+  0x55, 0x60, 0x2f, 0x19, 0x64, 0x37, 0x03, 0x20, 0x5d, 0x0c, 0x0a, 0x01, 0x62, 0x33, 0x27, 0x3d,
+  0x3a, 0x1c, 0x1d, 0x00, 0x45, 0x29, 0x6e, 0x66, 0x65, 0x5e, 0x05, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x6a, 0x46, 0x6c, 0x68, 0x0f, 0x64, 0x1c, 0x30, 0x2a, 0x69, 0x30, 0x09, 0x07,
+  0x01, 0x21, 0x66, 0x5e, 0x08, 0x5a, 0x1f, 0x09, 0x12, 0x56, 0x3b, 0x5f, 0x20, 0x5c, 0x60, 0x10,
+  0x00, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4a, 0x3a, 0x25, 0x6f, 0x5b, 0x0b, 0x06, 0x2c,
+  0x03, 0x08, 0x46, 0x15, 0x00, 0x51, 0x38, 0x23, 0x0f, 0x23, 0x3b, 0x67, 0x2f, 0x02, 0x3b, 0x4c,
+  0x60, 0x25, 0x3d, 0x70, 0x4e, 0x26, 0x6f, 0x31, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d,
+  0x3b, 0x3b, 0x60, 0x36, 0x45, 0x3e, 0x00, 0x30, 0x1f, 0x70, 0x19, 0x20, 0x0e, 0x19, 0x39, 0x5c,
+  0x50, 0x02, 0x2c, 0x18, 0x60, 0x67, 0x50, 0x46, 0x1f, 0x71, 0x30, 0x50, 0x06, 0x2c, 0x01, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x09, 0x09, 0x3a, 0x40, 0x43, 0x53, 0x19, 0x19, 0x35, 0x09,
+  0x23, 0x6d, 0x62, 0x15, 0x4d, 0x19, 0x48, 0x2c, 0x19, 0x42, 0x14, 0x3c, 0x09, 0x1b, 0x02, 0x09,
+  0x03, 0x62, 0x28, 0x18, 0x01, 0x1f, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x56, 0x5e, 0x55, 0x5d,
+  0x4a, 0x15, 0x66, 0x05, 0x70, 0x01, 0x69, 0x09, 0x30, 0x40, 0x4e, 0x3a, 0x30, 0x03, 0x03, 0x33,
+  0x53, 0x3b, 0x34, 0x18, 0x01, 0x42, 0x09, 0x59, 0x1c, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x58, 0x62, 0x3b, 0x09, 0x4d, 0x6d, 0x27, 0x03, 0x0c, 0x03, 0x46, 0x0c, 0x17, 0x62, 0x03, 0x5b,
+  0x15, 0x26, 0x42, 0x30, 0x00, 0x08, 0x28, 0x6a, 0x24, 0x42, 0x00, 0x40, 0x30, 0x00, 0x41, 0x67,
+  0x1a, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x45, 0x50, 0x25, 0x62, 0x47, 0x25, 0x02, 0x00,
+  0x51, 0x68, 0x2c, 0x69, 0x2b, 0x4b, 0x0e, 0x30, 0x2b, 0x30, 0x10, 0x1c, 0x05, 0x2f, 0x67, 0x1d,
+  0x64, 0x45, 0x03, 0x00, 0x43, 0x4e, 0x3b, 0x5a, 0x2f, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x4e, 0x26, 0x46, 0x48, 0x39, 0x71, 0x1c, 0x30, 0x40, 0x5a, 0x37, 0x5b, 0x16, 0x38, 0x15, 0x0c,
+  0x00, 0x4d, 0x6a, 0x52, 0x18, 0x4c, 0x02, 0x6c, 0x29, 0x54, 0x00, 0x71, 0x5c, 0x3a, 0x1c, 0x35,
+  0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x60, 0x1b, 0x6a, 0x22, 0x09, 0x05, 0x42, 0x47,
+  0x58, 0x0b, 0x40, 0x55, 0x07, 0x19, 0x01, 0x03, 0x60, 0x58, 0x35, 0x58, 0x2c, 0x6f, 0x5f, 0x21,
+  0x2f, 0x70, 0x66, 0x6a, 0x19, 0x12, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4e, 0x65, 0x34,
+  0x65, 0x0f, 0x71, 0x03, 0x05, 0x0f, 0x49, 0x39, 0x4d, 0x61, 0x5d, 0x23, 0x23, 0x00, 0x4d, 0x11,
+  0x3f, 0x52, 0x53, 0x30, 0x60, 0x3d, 0x39, 0x4c, 0x20, 0x44, 0x63, 0x03, 0x02, 0x01, 0x1f, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x4e, 0x56, 0x24, 0x14, 0x16, 0x25, 0x15, 0x31, 0x2d, 0x06, 0x68, 0x39,
+  0x5c, 0x0d, 0x01, 0x19, 0x00, 0x4d, 0x63, 0x1d, 0x1f, 0x33, 0x42, 0x3a, 0x1f, 0x40, 0x58, 0x6e,
+  0x61, 0x64, 0x05, 0x5a, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x13, 0x45, 0x29, 0x21,
+  0x6d, 0x31, 0x18, 0x54, 0x63, 0x23, 0x0f, 0x03, 0x37, 0x0c, 0x15, 0x30, 0x65, 0x64, 0x4a, 0x6c,
+  0x1c, 0x5e, 0x02, 0x2b, 0x53, 0x04, 0x68, 0x6c, 0x1a, 0x52, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x4e, 0x1d, 0x54, 0x3e, 0x2d, 0x5d, 0x2f, 0x1a, 0x41, 0x50, 0x03, 0x21, 0x4e, 0x4f, 0x2b,
+  0x30, 0x00, 0x4d, 0x6f, 0x10, 0x08, 0x63, 0x52, 0x09, 0x18, 0x01, 0x33, 0x6d, 0x36, 0x29, 0x52,
+  0x4c, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x3e, 0x21, 0x3f, 0x0a, 0x43, 0x52, 0x35,
+  0x37, 0x09, 0x19, 0x0a, 0x44, 0x0a, 0x5b, 0x03, 0x15, 0x64, 0x62, 0x5f, 0x3a, 0x58, 0x62, 0x42,
+  0x19, 0x6c, 0x6b, 0x55, 0x33, 0x57, 0x51, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0x49,
+  0x39, 0x3d, 0x0b, 0x45, 0x67, 0x02, 0x43, 0x26, 0x61, 0x54, 0x36, 0x0f, 0x40, 0x30, 0x4e, 0x56,
+  0x00, 0x4b, 0x2a, 0x09, 0x3f, 0x48, 0x03, 0x30, 0x63, 0x1e, 0x47, 0x5f, 0x08, 0x27, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x56, 0x08, 0x40, 0x57, 0x54, 0x0b, 0x3d, 0x52, 0x34, 0x64, 0x4d,
+  0x4f, 0x22, 0x4d, 0x4d, 0x15, 0x19, 0x14, 0x10, 0x13, 0x62, 0x1d, 0x6a, 0x00, 0x00, 0x45, 0x3a,
+  0x69, 0x22, 0x53, 0x3e, 0x1f, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x3c, 0x2b, 0x51,
+  0x4b, 0x0f, 0x49, 0x51, 0x1e, 0x2a, 0x2d, 0x45, 0x0b, 0x5b, 0x39, 0x19, 0x5c, 0x6c, 0x64, 0x64,
+  0x26, 0x64, 0x65, 0x2f, 0x19, 0x09, 0x32, 0x16, 0x3d, 0x13, 0x67, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x57, 0x01, 0x02, 0x4f, 0x55, 0x2a, 0x1f, 0x07, 0x08, 0x45, 0x37, 0x2e, 0x0c,
+  0x0f, 0x23, 0x23, 0x13, 0x1d, 0x11, 0x65, 0x10, 0x14, 0x4c, 0x01, 0x62, 0x43, 0x2d, 0x58, 0x65,
+  0x57, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x27, 0x19, 0x1a, 0x41, 0x2b, 0x6c, 0x57,
+  0x04, 0x1f, 0x32, 0x24, 0x32, 0x23, 0x21, 0x01, 0x66, 0x06, 0x3f, 0x26, 0x13, 0x62, 0x29, 0x58,
+  0x2b, 0x26, 0x17, 0x0b, 0x1f, 0x26, 0x58, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x53, 0x52,
+  0x30, 0x31, 0x45, 0x66, 0x65, 0x4a, 0x25, 0x35, 0x07, 0x0d, 0x6b, 0x15, 0x0a, 0x0c, 0x01, 0x29,
+  0x58, 0x3b, 0x3e, 0x00, 0x48, 0x3e, 0x53, 0x40, 0x65, 0x2e, 0x4b, 0x4c, 0x62, 0x4a, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x5b, 0x42, 0x2e, 0x15, 0x10, 0x3d, 0x70, 0x05,
+  0x20, 0x34, 0x6e, 0x03, 0x54, 0x2b, 0x44, 0x1d, 0x52, 0x09, 0x08, 0x10, 0x3f, 0x33, 0x39, 0x13,
+  0x41, 0x41, 0x02, 0x09, 0x3c, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x1a, 0x19, 0x03,
+  0x37, 0x03, 0x3b, 0x08, 0x62, 0x03, 0x09, 0x5d, 0x71, 0x15, 0x4f, 0x5b, 0x0c, 0x2a, 0x1c, 0x00,
+  0x4a, 0x57, 0x64, 0x3d, 0x6c, 0x21, 0x3e, 0x4b, 0x2e, 0x2f, 0x3a, 0x3d, 0x01, 0x1f, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x5d, 0x2c, 0x01, 0x15, 0x17, 0x19, 0x09, 0x3f, 0x09, 0x2c, 0x71, 0x1b, 0x09,
+  0x23, 0x45, 0x40, 0x61, 0x33, 0x42, 0x50, 0x52, 0x1d, 0x57, 0x63, 0x54, 0x08, 0x0b, 0x17, 0x18,
+  0x63, 0x59, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x46, 0x05, 0x2b, 0x00, 0x24, 0x44, 0x5e,
+  0x5f, 0x00, 0x55, 0x5a, 0x38, 0x07, 0x70, 0x0c, 0x37, 0x4d, 0x2b, 0x3e, 0x30, 0x10, 0x1a, 0x3f,
+  0x51, 0x3a, 0x45, 0x57, 0x2d, 0x43, 0x00, 0x6c, 0x08, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x5d, 0x15, 0x40, 0x1c, 0x43, 0x5b, 0x26, 0x3e, 0x71, 0x58, 0x1e, 0x46, 0x04, 0x5b, 0x24, 0x39,
+  0x68, 0x28, 0x2c, 0x63, 0x05, 0x58, 0x02, 0x09, 0x24, 0x52, 0x16, 0x32, 0x42, 0x33, 0x53, 0x01,
+  0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x03, 0x39, 0x12, 0x0d, 0x47, 0x63, 0x2a, 0x0e, 0x49,
+  0x24, 0x38, 0x1e, 0x4d, 0x0d, 0x0f, 0x5b, 0x5f, 0x02, 0x56, 0x03, 0x52, 0x1a, 0x62, 0x34, 0x1a,
+  0x22, 0x69, 0x03, 0x53, 0x3f, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5a, 0x30, 0x21, 0x4c,
+  0x32, 0x21, 0x14, 0x29, 0x6e, 0x06, 0x4b, 0x25, 0x43, 0x0f, 0x34, 0x21, 0x36, 0x49, 0x67, 0x06,
+  0x19, 0x1c, 0x31, 0x26, 0x1b, 0x05, 0x47, 0x1e, 0x00, 0x41, 0x58, 0x49, 0x01, 0x1f, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x5d, 0x19, 0x54, 0x67, 0x34, 0x4b, 0x1d, 0x13, 0x46, 0x63, 0x0f, 0x0e, 0x41,
+  0x0a, 0x5d, 0x0a, 0x40, 0x3f, 0x08, 0x33, 0x1c, 0x42, 0x42, 0x65, 0x46, 0x03, 0x55, 0x6b, 0x42,
+  0x4c, 0x5f, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x31, 0x45, 0x3c, 0x69, 0x37, 0x5f,
+  0x14, 0x6b, 0x50, 0x36, 0x3b, 0x2d, 0x4f, 0x1b, 0x54, 0x55, 0x53, 0x33, 0x49, 0x5a, 0x30, 0x03,
+  0x13, 0x25, 0x19, 0x36, 0x6d, 0x00, 0x2f, 0x28, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d,
+  0x1c, 0x24, 0x53, 0x5d, 0x32, 0x59, 0x64, 0x5d, 0x09, 0x01, 0x62, 0x47, 0x37, 0x07, 0x4f, 0x4d,
+  0x08, 0x14, 0x59, 0x67, 0x2c, 0x15, 0x3e, 0x3b, 0x1c, 0x68, 0x04, 0x18, 0x00, 0x3e, 0x01, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x35, 0x34, 0x28, 0x1e, 0x1b, 0x57, 0x65, 0x32, 0x26, 0x30,
+  0x09, 0x68, 0x0d, 0x46, 0x45, 0x47, 0x59, 0x60, 0x58, 0x59, 0x02, 0x00, 0x08, 0x09, 0x5a, 0x61,
+  0x6e, 0x2f, 0x03, 0x33, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x49, 0x5a, 0x1b, 0x1d, 0x1b,
+  0x04, 0x4c, 0x11, 0x24, 0x64, 0x15, 0x00, 0x4b, 0x66, 0x5d, 0x38, 0x37, 0x39, 0x3d, 0x3b, 0x27,
+  0x28, 0x67, 0x1c, 0x57, 0x00, 0x45, 0x67, 0x44, 0x20, 0x02, 0x42, 0x2a, 0x01, 0x1f, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x49, 0x51, 0x46, 0x6c, 0x6b, 0x0e, 0x35, 0x6a, 0x2e, 0x2a, 0x44, 0x00, 0x52,
+  0x30, 0x07, 0x25, 0x24, 0x22, 0x3c, 0x09, 0x5a, 0x06, 0x08, 0x12, 0x52, 0x3b, 0x59, 0x66, 0x70,
+  0x4c, 0x18, 0x1d, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4a, 0x67, 0x25, 0x6f, 0x07, 0x09,
+  0x2c, 0x26, 0x4f, 0x08, 0x40, 0x62, 0x00, 0x51, 0x38, 0x0e, 0x0d, 0x0f, 0x4a, 0x3a, 0x2f, 0x6f,
+  0x33, 0x4c, 0x1a, 0x25, 0x28, 0x5c, 0x71, 0x1f, 0x02, 0x29, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x43, 0x4a, 0x3b, 0x60, 0x6d, 0x00, 0x58, 0x42, 0x48, 0x0b, 0x1f, 0x16, 0x3b, 0x66, 0x0e,
+  0x3b, 0x34, 0x16, 0x58, 0x65, 0x2c, 0x10, 0x14, 0x67, 0x05, 0x46, 0x06, 0x4e, 0x09, 0x58, 0x1f,
+  0x06, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x59, 0x59, 0x09, 0x3a, 0x46, 0x70, 0x03, 0x3b,
+  0x21, 0x35, 0x4f, 0x0e, 0x68, 0x62, 0x62, 0x5d, 0x21, 0x57, 0x06, 0x19, 0x5e, 0x60, 0x3c, 0x03,
+  0x1b, 0x6f, 0x30, 0x00, 0x42, 0x3d, 0x3d, 0x13, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x40,
+  0x3f, 0x00, 0x57, 0x5e, 0x04, 0x38, 0x19, 0x62, 0x22, 0x05, 0x43, 0x25, 0x47, 0x09, 0x09, 0x1b,
+  0x2d, 0x67, 0x5f, 0x03, 0x09, 0x3b, 0x53, 0x19, 0x34, 0x10, 0x03, 0x00, 0x42, 0x53, 0x5f, 0x6c,
+  0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4c, 0x28, 0x3b, 0x09, 0x38, 0x6b, 0x18, 0x09, 0x4d,
+  0x03, 0x1b, 0x38, 0x2d, 0x62, 0x00, 0x4a, 0x07, 0x0a, 0x1f, 0x3c, 0x30, 0x48, 0x09, 0x28, 0x1c,
+  0x24, 0x5e, 0x01, 0x42, 0x5f, 0x29, 0x14, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x45, 0x2a,
+  0x25, 0x62, 0x6e, 0x34, 0x12, 0x00, 0x45, 0x36, 0x2c, 0x6e, 0x46, 0x41, 0x0e, 0x00, 0x4f, 0x46,
+  0x0b, 0x27, 0x51, 0x05, 0x11, 0x3a, 0x1d, 0x5a, 0x45, 0x09, 0x30, 0x71, 0x33, 0x64, 0x56, 0x01,
+  0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x45, 0x06, 0x46, 0x48, 0x25, 0x17, 0x51, 0x00, 0x56, 0x2b,
+  0x5a, 0x62, 0x07, 0x43, 0x38, 0x62, 0x38, 0x54, 0x51, 0x2f, 0x18, 0x14, 0x65, 0x6c, 0x67, 0x54,
+  0x48, 0x4e, 0x70, 0x29, 0x6a, 0x64, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x14, 0x1b,
+  0x6a, 0x20, 0x4f, 0x58, 0x5e, 0x44, 0x58, 0x09, 0x1b, 0x1e, 0x07, 0x3b, 0x25, 0x4b, 0x4c, 0x05,
+  0x35, 0x2a, 0x06, 0x6f, 0x59, 0x21, 0x11, 0x5c, 0x20, 0x6c, 0x3b, 0x6f, 0x01, 0x1f, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x5d, 0x6f, 0x34, 0x65, 0x0e, 0x2d, 0x08, 0x50, 0x23, 0x49, 0x25, 0x5d, 0x04,
+  0x5d, 0x0e, 0x0e, 0x4f, 0x52, 0x03, 0x52, 0x3f, 0x5f, 0x60, 0x28, 0x39, 0x14, 0x66, 0x6e, 0x64,
+  0x09, 0x65, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x11, 0x24, 0x14, 0x70, 0x39, 0x28,
+  0x3a, 0x4e, 0x06, 0x6b, 0x34, 0x70, 0x0d, 0x25, 0x3b, 0x41, 0x5a, 0x00, 0x1f, 0x4a, 0x3c, 0x3a,
+  0x06, 0x40, 0x2a, 0x44, 0x04, 0x63, 0x50, 0x63, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d,
+  0x10, 0x45, 0x29, 0x3b, 0x36, 0x29, 0x10, 0x30, 0x63, 0x0d, 0x0d, 0x09, 0x37, 0x38, 0x62, 0x45,
+  0x02, 0x35, 0x4a, 0x51, 0x51, 0x5e, 0x6f, 0x2b, 0x3f, 0x61, 0x6d, 0x6a, 0x60, 0x11, 0x01, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x48, 0x54, 0x3e, 0x71, 0x0c, 0x56, 0x60, 0x03, 0x50, 0x41,
+  0x24, 0x71, 0x4f, 0x46, 0x09, 0x2e, 0x12, 0x27, 0x08, 0x35, 0x2f, 0x09, 0x10, 0x01, 0x4a, 0x68,
+  0x6b, 0x3a, 0x56, 0x60, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4d, 0x5e, 0x21, 0x3f, 0x62,
+  0x5c, 0x11, 0x63, 0x15, 0x09, 0x21, 0x37, 0x6e, 0x0a, 0x07, 0x00, 0x4e, 0x37, 0x35, 0x3d, 0x5f,
+  0x31, 0x05, 0x62, 0x5e, 0x19, 0x51, 0x36, 0x1e, 0x3b, 0x1d, 0x6a, 0x01, 0x1f, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x4d, 0x09, 0x39, 0x3d, 0x09, 0x30, 0x3a, 0x6f, 0x5c, 0x26, 0x55, 0x45, 0x6b, 0x0f,
+  0x1b, 0x00, 0x4e, 0x17, 0x2f, 0x28, 0x2a, 0x30, 0x03, 0x48, 0x09, 0x30, 0x35, 0x55, 0x69, 0x09,
+  0x49, 0x10, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x41, 0x40, 0x57, 0x01, 0x51, 0x62,
+  0x56, 0x01, 0x64, 0x0c, 0x4f, 0x32, 0x4d, 0x5d, 0x62, 0x24, 0x1a, 0x13, 0x13, 0x15, 0x00, 0x6a,
+  0x48, 0x00, 0x42, 0x31, 0x47, 0x32, 0x00, 0x41, 0x3c, 0x26, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x42, 0x5e, 0x2b, 0x51, 0x00, 0x59, 0x23, 0x09, 0x6c, 0x61, 0x2a, 0x4e, 0x54, 0x2e, 0x5b,
+  0x34, 0x3b, 0x43, 0x1c, 0x63, 0x64, 0x2c, 0x35, 0x65, 0x11, 0x19, 0x30, 0x22, 0x43, 0x62, 0x27,
+  0x3a, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42, 0x48, 0x01, 0x02, 0x00, 0x59, 0x61, 0x50,
+  0x06, 0x5b, 0x08, 0x30, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0d, 0x18, 0x48, 0x11, 0x12, 0x27, 0x14,
+  0x14, 0x01, 0x15, 0x16, 0x17, 0x50, 0x12, 0x48, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42,
+  0x10, 0x19, 0x1a, 0x00, 0x59, 0x40, 0x6a, 0x1d, 0x55, 0x1f, 0x66, 0x21, 0x22, 0x23, 0x24, 0x25,
+  0x32, 0x2c, 0x09, 0x26, 0x27, 0x3d, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x26, 0x2c, 0x50, 0x01,
+  0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x42, 0x11, 0x30, 0x31, 0x00, 0x59, 0x22, 0x6f, 0x33, 0x39,
+  0x35, 0x5b, 0x0f, 0x36, 0x15, 0x37, 0x38, 0x34, 0x31, 0x50, 0x3b, 0x3c, 0x28, 0x3e, 0x3f, 0x40,
+  0x12, 0x0b, 0x41, 0x60, 0x15, 0x3b, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x40, 0x6f, 0x00,
+  0x40, 0x42, 0x00, 0x59, 0x0a, 0x13, 0x28, 0x16, 0x05, 0x22, 0x39, 0x44, 0x03, 0x45, 0x46, 0x69,
+  0x00, 0x11, 0x09, 0x49, 0x13, 0x3f, 0x4a, 0x39, 0x27, 0x4b, 0x4b, 0x65, 0x30, 0x5e, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x14, 0x19, 0x03, 0x62, 0x41, 0x33, 0x49, 0x0a, 0x03, 0x54,
+  0x4d, 0x4e, 0x15, 0x4f, 0x07, 0x5d, 0x05, 0x6c, 0x00, 0x4a, 0x1d, 0x63, 0x3d, 0x51, 0x21, 0x3c,
+  0x41, 0x0b, 0x56, 0x31, 0x62, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x06, 0x01, 0x15,
+  0x71, 0x24, 0x3f, 0x53, 0x4b, 0x2c, 0x17, 0x40, 0x03, 0x23, 0x54, 0x1b, 0x1e, 0x19, 0x3e, 0x50,
+  0x56, 0x48, 0x57, 0x35, 0x54, 0x49, 0x2e, 0x2d, 0x13, 0x35, 0x09, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5c, 0x2a, 0x2b, 0x00, 0x3b, 0x69, 0x3c, 0x59, 0x45, 0x5a, 0x5d, 0x5b, 0x5c, 0x0c,
+  0x0a, 0x5d, 0x1b, 0x42, 0x59, 0x10, 0x60, 0x09, 0x51, 0x31, 0x45, 0x1d, 0x17, 0x16, 0x1d, 0x51,
+  0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5c, 0x28, 0x40, 0x1c, 0x70, 0x07, 0x1f, 0x3c,
+  0x17, 0x58, 0x04, 0x2b, 0x61, 0x5b, 0x21, 0x34, 0x6b, 0x15, 0x1f, 0x63, 0x50, 0x50, 0x02, 0x30,
+  0x24, 0x56, 0x43, 0x22, 0x3e, 0x4a, 0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5c, 0x3f,
+  0x39, 0x12, 0x0e, 0x6e, 0x5a, 0x58, 0x0d, 0x49, 0x3b, 0x0c, 0x55, 0x4d, 0x0f, 0x0d, 0x07, 0x30,
+  0x12, 0x56, 0x09, 0x11, 0x1a, 0x15, 0x34, 0x60, 0x32, 0x47, 0x49, 0x3f, 0x00, 0x01, 0x1f, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x5c, 0x59, 0x21, 0x4c, 0x20, 0x3b, 0x1a, 0x67, 0x69, 0x06, 0x09, 0x01,
+  0x16, 0x0f, 0x39, 0x24, 0x6d, 0x03, 0x31, 0x06, 0x3b, 0x6c, 0x31, 0x2c, 0x1b, 0x50, 0x69, 0x55,
+  0x08, 0x2a, 0x00, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x4a, 0x54, 0x67, 0x25, 0x09,
+  0x00, 0x27, 0x1b, 0x63, 0x0e, 0x23, 0x4b, 0x0a, 0x4d, 0x37, 0x46, 0x00, 0x4b, 0x03, 0x33, 0x6a,
+  0x3e, 0x42, 0x12, 0x46, 0x09, 0x1e, 0x36, 0x3c, 0x14, 0x00, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x4f, 0x67, 0x45, 0x3c, 0x6e, 0x62, 0x30, 0x4c, 0x6d, 0x50, 0x6d, 0x19, 0x17, 0x4f, 0x40,
+  0x45, 0x04, 0x00, 0x4c, 0x19, 0x49, 0x64, 0x59, 0x03, 0x27, 0x25, 0x3b, 0x6b, 0x68, 0x57, 0x11,
+  0x62, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x44, 0x51, 0x24, 0x53, 0x38, 0x20, 0x00, 0x49,
+  0x5a, 0x38, 0x09, 0x34, 0x15, 0x69, 0x37, 0x5b, 0x4f, 0x38, 0x00, 0x4c, 0x1a, 0x59, 0x29, 0x1f,
+  0x15, 0x3c, 0x3b, 0x6a, 0x6d, 0x61, 0x27, 0x48, 0x5e, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x5d, 0x5a, 0x34, 0x28, 0x04, 0x46, 0x00, 0x12, 0x20, 0x26, 0x2e, 0x30, 0x6d, 0x0d, 0x2b, 0x54,
+  0x6e, 0x30, 0x4c, 0x58, 0x5f, 0x12, 0x00, 0x49, 0x09, 0x64, 0x04, 0x44, 0x52, 0x09, 0x3b, 0x01,
+  0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x56, 0x35, 0x1b, 0x1d, 0x46, 0x1e, 0x1a, 0x2f, 0x3b, 0x64,
+  0x0a, 0x03, 0x20, 0x5d, 0x0c, 0x0a, 0x25, 0x15, 0x4a, 0x27, 0x3d, 0x31, 0x1c, 0x1d, 0x00, 0x45,
+  0x29, 0x6e, 0x66, 0x12, 0x5e, 0x50, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x1c, 0x46,
+  0x6c, 0x6d, 0x0d, 0x5a, 0x1c, 0x09, 0x2a, 0x47, 0x30, 0x09, 0x07, 0x01, 0x21, 0x20, 0x42, 0x49,
+  0x5a, 0x1f, 0x03, 0x12, 0x56, 0x3b, 0x5f, 0x20, 0x5c, 0x1a, 0x10, 0x48, 0x01, 0x1f, 0x00, 0x21,
+  0x00, 0x00, 0x00, 0x46, 0x31, 0x25, 0x6f, 0x07, 0x2e, 0x1f, 0x2c, 0x00, 0x42, 0x08, 0x2b, 0x15,
+  0x00, 0x51, 0x38, 0x23, 0x0f, 0x0e, 0x19, 0x29, 0x2f, 0x02, 0x19, 0x4c, 0x60, 0x25, 0x3d, 0x70,
+  0x4e, 0x2c, 0x6f, 0x3a, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x46, 0x19, 0x3b, 0x60, 0x6b,
+  0x54, 0x3c, 0x00, 0x00, 0x55, 0x1f, 0x5c, 0x19, 0x20, 0x0e, 0x19, 0x39, 0x70, 0x05, 0x6f, 0x2c,
+  0x18, 0x1a, 0x67, 0x50, 0x46, 0x1f, 0x71, 0x30, 0x05, 0x06, 0x26, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x30, 0x09, 0x3a, 0x1b, 0x16, 0x3f, 0x19, 0x3b, 0x35, 0x03, 0x23, 0x6d, 0x62,
+  0x15, 0x4d, 0x3b, 0x00, 0x26, 0x19, 0x42, 0x4c, 0x3c, 0x09, 0x1b, 0x02, 0x09, 0x03, 0x15, 0x28,
+  0x10, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x56, 0x5e, 0x1e, 0x4d, 0x33,
+  0x15, 0x20, 0x05, 0x5c, 0x01, 0x69, 0x09, 0x30, 0x40, 0x71, 0x31, 0x09, 0x03, 0x03, 0x4a, 0x53,
+  0x3b, 0x34, 0x18, 0x01, 0x42, 0x03, 0x59, 0x6a, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x58,
+  0x15, 0x3b, 0x09, 0x5d, 0x68, 0x13, 0x03, 0x38, 0x03, 0x2b, 0x0c, 0x17, 0x62, 0x03, 0x5b, 0x62,
+  0x2c, 0x5e, 0x30, 0x00, 0x49, 0x28, 0x6a, 0x24, 0x42, 0x00, 0x43, 0x30, 0x30, 0x67, 0x60, 0x01,
+  0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x45, 0x05, 0x25, 0x62, 0x69, 0x01, 0x6f, 0x00, 0x51, 0x6d,
+  0x2c, 0x47, 0x2b, 0x4b, 0x0e, 0x30, 0x2b, 0x09, 0x18, 0x6a, 0x05, 0x2f, 0x29, 0x1d, 0x64, 0x45,
+  0x03, 0x00, 0x43, 0x4e, 0x19, 0x5a, 0x11, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4e, 0x2c,
+  0x46, 0x48, 0x34, 0x4e, 0x6a, 0x30, 0x1b, 0x5a, 0x0a, 0x5b, 0x16, 0x38, 0x15, 0x0c, 0x00, 0x4d,
+  0x1c, 0x56, 0x18, 0x4c, 0x6f, 0x6c, 0x29, 0x54, 0x00, 0x71, 0x5c, 0x31, 0x1c, 0x63, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x4e, 0x1a, 0x1b, 0x6a, 0x32, 0x03, 0x50, 0x42, 0x69, 0x58, 0x2e,
+  0x40, 0x55, 0x07, 0x19, 0x01, 0x00, 0x4d, 0x1a, 0x2a, 0x35, 0x58, 0x26, 0x6f, 0x5f, 0x21, 0x2f,
+  0x70, 0x66, 0x1c, 0x19, 0x65, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4e, 0x12, 0x34, 0x65,
+  0x0d, 0x4e, 0x09, 0x05, 0x0d, 0x49, 0x34, 0x4d, 0x61, 0x5d, 0x23, 0x23, 0x00, 0x4d, 0x2f, 0x53,
+  0x52, 0x53, 0x09, 0x60, 0x3d, 0x39, 0x4c, 0x20, 0x44, 0x35, 0x03, 0x6f, 0x01, 0x1f, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x4e, 0x52, 0x24, 0x14, 0x43, 0x01, 0x62, 0x31, 0x17, 0x06, 0x6d, 0x39, 0x5c,
+  0x0d, 0x01, 0x19, 0x00, 0x4d, 0x35, 0x57, 0x1f, 0x33, 0x5e, 0x3a, 0x1f, 0x40, 0x58, 0x6e, 0x61,
+  0x5a, 0x05, 0x64, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4e, 0x27, 0x45, 0x29, 0x24, 0x68,
+  0x3a, 0x18, 0x45, 0x63, 0x0e, 0x0f, 0x03, 0x37, 0x0c, 0x15, 0x00, 0x4d, 0x12, 0x5a, 0x4a, 0x6c,
+  0x6a, 0x5e, 0x02, 0x2b, 0x53, 0x04, 0x68, 0x51, 0x1a, 0x56, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x4e, 0x57, 0x54, 0x3e, 0x17, 0x4d, 0x11, 0x1a, 0x4b, 0x50, 0x09, 0x21, 0x4e, 0x4f, 0x2b,
+  0x30, 0x00, 0x4d, 0x02, 0x18, 0x08, 0x63, 0x56, 0x09, 0x18, 0x01, 0x33, 0x6d, 0x36, 0x67, 0x52,
+  0x14, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x3c, 0x21, 0x3f, 0x37, 0x16, 0x56, 0x35,
+  0x0a, 0x09, 0x3b, 0x0a, 0x44, 0x0a, 0x5b, 0x03, 0x62, 0x5a, 0x15, 0x5f, 0x3a, 0x2a, 0x62, 0x42,
+  0x19, 0x6c, 0x6b, 0x55, 0x4a, 0x57, 0x6c, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0x08,
+  0x39, 0x3d, 0x2e, 0x54, 0x29, 0x02, 0x16, 0x26, 0x04, 0x54, 0x36, 0x0f, 0x40, 0x30, 0x71, 0x52,
+  0x00, 0x4b, 0x2a, 0x09, 0x53, 0x48, 0x03, 0x30, 0x63, 0x1e, 0x47, 0x59, 0x08, 0x13, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x56, 0x49, 0x40, 0x57, 0x45, 0x2e, 0x28, 0x52, 0x39, 0x64, 0x5d,
+  0x4f, 0x22, 0x4d, 0x4d, 0x15, 0x3b, 0x4c, 0x18, 0x13, 0x62, 0x57, 0x6a, 0x00, 0x00, 0x45, 0x3a,
+  0x69, 0x22, 0x3f, 0x3e, 0x06, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x3e, 0x2b, 0x51,
+  0x41, 0x0d, 0x08, 0x51, 0x55, 0x2a, 0x17, 0x45, 0x0b, 0x5b, 0x39, 0x19, 0x70, 0x51, 0x5a, 0x64,
+  0x26, 0x5a, 0x65, 0x2f, 0x19, 0x09, 0x32, 0x16, 0x28, 0x13, 0x29, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x1d, 0x01, 0x02, 0x4f, 0x1e, 0x58, 0x1f, 0x5b, 0x08, 0x54, 0x37, 0x2e, 0x0c,
+  0x0f, 0x23, 0x0e, 0x27, 0x57, 0x11, 0x65, 0x18, 0x14, 0x4c, 0x01, 0x62, 0x43, 0x2d, 0x2a, 0x65,
+  0x1d, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x13, 0x19, 0x1a, 0x4b, 0x46, 0x51, 0x57,
+  0x61, 0x1f, 0x22, 0x24, 0x32, 0x23, 0x21, 0x01, 0x20, 0x1f, 0x53, 0x26, 0x13, 0x15, 0x29, 0x58,
+  0x2b, 0x26, 0x17, 0x0b, 0x06, 0x26, 0x2a, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x53, 0x56,
+  0x30, 0x31, 0x54, 0x20, 0x12, 0x4a, 0x01, 0x35, 0x5b, 0x0d, 0x6b, 0x15, 0x0a, 0x0c, 0x25, 0x67,
+  0x2a, 0x3b, 0x3e, 0x00, 0x48, 0x3e, 0x53, 0x40, 0x65, 0x2e, 0x4b, 0x14, 0x62, 0x33, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x65, 0x00, 0x5b, 0x42, 0x0b, 0x62, 0x18, 0x3d, 0x5c, 0x05,
+  0x66, 0x34, 0x6e, 0x03, 0x54, 0x2b, 0x6e, 0x57, 0x56, 0x09, 0x08, 0x18, 0x3f, 0x33, 0x39, 0x13,
+  0x41, 0x41, 0x6f, 0x09, 0x3e, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x60, 0x19, 0x03,
+  0x0a, 0x09, 0x19, 0x08, 0x15, 0x03, 0x30, 0x5d, 0x71, 0x15, 0x4f, 0x5b, 0x38, 0x58, 0x6a, 0x00,
+  0x4a, 0x57, 0x5a, 0x3d, 0x6c, 0x21, 0x3e, 0x4b, 0x2e, 0x11, 0x3a, 0x28, 0x01, 0x1f, 0x00, 0x1f,
+  0x00, 0x00, 0x00, 0x5d, 0x26, 0x01, 0x15, 0x2d, 0x3b, 0x03, 0x3f, 0x03, 0x2c, 0x4e, 0x1b, 0x09,
+  0x23, 0x45, 0x40, 0x04, 0x4a, 0x5e, 0x50, 0x52, 0x57, 0x57, 0x63, 0x54, 0x08, 0x0b, 0x17, 0x10,
+  0x63, 0x5f, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x50, 0x2b, 0x00, 0x21, 0x6e, 0x42,
+  0x5f, 0x30, 0x5a, 0x0c, 0x07, 0x70, 0x0c, 0x37, 0x4d, 0x46, 0x3c, 0x09, 0x10, 0x1a, 0x53, 0x51,
+  0x3a, 0x45, 0x57, 0x2d, 0x43, 0x48, 0x6c, 0x49, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d,
+  0x62, 0x40, 0x1c, 0x16, 0x07, 0x2c, 0x3e, 0x4e, 0x58, 0x55, 0x46, 0x04, 0x5b, 0x24, 0x39, 0x6d,
+  0x3d, 0x26, 0x63, 0x05, 0x2a, 0x02, 0x09, 0x24, 0x52, 0x16, 0x32, 0x5e, 0x33, 0x3f, 0x01, 0x1f,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x09, 0x39, 0x12, 0x0f, 0x69, 0x35, 0x2a, 0x23, 0x49, 0x21,
+  0x38, 0x1e, 0x4d, 0x0d, 0x0f, 0x07, 0x59, 0x6f, 0x56, 0x03, 0x56, 0x1a, 0x62, 0x34, 0x1a, 0x22,
+  0x69, 0x09, 0x53, 0x53, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x59, 0x21, 0x4c, 0x22,
+  0x24, 0x4c, 0x29, 0x44, 0x06, 0x41, 0x25, 0x43, 0x0f, 0x34, 0x21, 0x6b, 0x08, 0x29, 0x06, 0x19,
+  0x6a, 0x31, 0x26, 0x1b, 0x05, 0x47, 0x1e, 0x00, 0x41, 0x58, 0x08, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x3b, 0x54, 0x67, 0x39, 0x41, 0x57, 0x13, 0x2b, 0x63, 0x0d, 0x0e, 0x41, 0x0a,
+  0x5d, 0x0a, 0x1b, 0x53, 0x49, 0x33, 0x1c, 0x5e, 0x42, 0x65, 0x46, 0x03, 0x55, 0x6b, 0x5e, 0x4c,
+  0x59, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x3a, 0x45, 0x3c, 0x47, 0x0a, 0x59, 0x14,
+  0x36, 0x50, 0x6b, 0x3b, 0x2d, 0x4f, 0x1b, 0x54, 0x1e, 0x3f, 0x4a, 0x49, 0x5a, 0x09, 0x03, 0x13,
+  0x25, 0x19, 0x36, 0x6d, 0x48, 0x2f, 0x3d, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x6a,
+  0x24, 0x53, 0x4d, 0x22, 0x5f, 0x64, 0x4d, 0x09, 0x25, 0x62, 0x47, 0x37, 0x07, 0x4f, 0x5d, 0x49,
+  0x4c, 0x59, 0x67, 0x26, 0x15, 0x3e, 0x3b, 0x1c, 0x68, 0x04, 0x10, 0x00, 0x3c, 0x01, 0x1f, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x5d, 0x63, 0x34, 0x28, 0x55, 0x40, 0x1d, 0x65, 0x22, 0x26, 0x09, 0x09,
+  0x68, 0x0d, 0x46, 0x45, 0x69, 0x5f, 0x1a, 0x58, 0x59, 0x6f, 0x00, 0x08, 0x09, 0x5a, 0x61, 0x6e,
+  0x11, 0x03, 0x4a, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x49, 0x64, 0x1b, 0x1d, 0x40, 0x61,
+  0x14, 0x11, 0x21, 0x64, 0x62, 0x00, 0x4b, 0x66, 0x5d, 0x38, 0x37, 0x34, 0x28, 0x19, 0x27, 0x28,
+  0x29, 0x1c, 0x57, 0x00, 0x45, 0x67, 0x44, 0x20, 0x6f, 0x42, 0x58, 0x01, 0x1f, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x49, 0x6c, 0x46, 0x6c, 0x36, 0x23, 0x63, 0x6a, 0x0b, 0x2a, 0x6e, 0x00, 0x52, 0x30,
+  0x07, 0x25, 0x24, 0x32, 0x3e, 0x03, 0x5a, 0x06, 0x49, 0x12, 0x52, 0x3b, 0x59, 0x66, 0x70, 0x14,
+  0x18, 0x57, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x25, 0x6f, 0x5b, 0x30, 0x26,
+  0x26, 0x4f, 0x08, 0x1b, 0x62, 0x00, 0x51, 0x38, 0x0e, 0x0d, 0x0d, 0x33, 0x31, 0x2f, 0x6f, 0x4a,
+  0x4c, 0x1a, 0x25, 0x28, 0x5c, 0x71, 0x06, 0x02, 0x67, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x43, 0x33, 0x3b, 0x60, 0x68, 0x00, 0x58, 0x5e, 0x48, 0x2e, 0x1f, 0x43, 0x3b, 0x66, 0x0e, 0x3b,
+  0x34, 0x43, 0x2a, 0x12, 0x2c, 0x10, 0x4c, 0x67, 0x05, 0x46, 0x06, 0x4e, 0x09, 0x2a, 0x1f, 0x1f,
+  0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x09, 0x3a, 0x2b, 0x5c, 0x09, 0x3b, 0x24,
+  0x35, 0x4f, 0x0e, 0x68, 0x62, 0x62, 0x5d, 0x24, 0x1d, 0x1f, 0x19, 0x5e, 0x1a, 0x3c, 0x03, 0x1b,
+  0x6f, 0x30, 0x00, 0x42, 0x28, 0x3d, 0x27, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x40, 0x53,
+  0x00, 0x57, 0x5e, 0x61, 0x0c, 0x3b, 0x62, 0x32, 0x05, 0x16, 0x25, 0x47, 0x09, 0x09, 0x1b, 0x17,
+  0x29, 0x59, 0x03, 0x09, 0x19, 0x53, 0x19, 0x34, 0x10, 0x03, 0x00, 0x42, 0x3f, 0x5f, 0x51, 0x01,
+  0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4c, 0x3d, 0x3b, 0x09, 0x0c, 0x36, 0x10, 0x09, 0x5d, 0x03,
+  0x40, 0x38, 0x2d, 0x62, 0x00, 0x4a, 0x07, 0x37, 0x06, 0x3e, 0x30, 0x48, 0x03, 0x28, 0x1c, 0x24,
+  0x5e, 0x01, 0x42, 0x59, 0x29, 0x4c, 0x01, 0x1f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x45, 0x58, 0x25,
+  0x62, 0x44, 0x39, 0x65, 0x00, 0x45, 0x6b, 0x2c, 0x44, 0x46, 0x41, 0x0e, 0x00, 0x4f, 0x46, 0x2e,
+  0x13, 0x6c, 0x05, 0x11, 0x31, 0x1d, 0x5a, 0x45, 0x09, 0x30, 0x71, 0x4a, 0x64, 0x52, 0x01, 0x1f,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x45, 0x1f, 0x46, 0x48, 0x01, 0x2d, 0x6c, 0x00, 0x56, 0x46, 0x5a,
+  0x15, 0x07, 0x43, 0x38, 0x62, 0x38, 0x45, 0x6c, 0x11, 0x18, 0x14, 0x12, 0x6c, 0x67, 0x54, 0x48,
+  0x4e, 0x70, 0x67, 0x6a, 0x5a, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x4c, 0x1b, 0x6a,
+  0x66, 0x4f, 0x2a, 0x5e, 0x6e, 0x58, 0x30, 0x1b, 0x1e, 0x07, 0x3b, 0x25, 0x41, 0x14, 0x50, 0x35,
+  0x2a, 0x1f, 0x6f, 0x59, 0x21, 0x11, 0x5c, 0x20, 0x51, 0x3b, 0x02, 0x01, 0x1f, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x5d, 0x02, 0x34, 0x65, 0x23, 0x17, 0x49, 0x50, 0x0e, 0x49, 0x01, 0x5d, 0x04, 0x5d,
+  0x0e, 0x0e, 0x4f, 0x56, 0x09, 0x52, 0x3f, 0x59, 0x60, 0x28, 0x39, 0x14, 0x66, 0x6e, 0x5a, 0x09,
+  0x12, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x2f, 0x24, 0x14, 0x5c, 0x34, 0x3d, 0x3a,
+  0x71, 0x06, 0x36, 0x34, 0x70, 0x0d, 0x25, 0x3b, 0x4b, 0x64, 0x48, 0x1f, 0x4a, 0x3e, 0x3a, 0x06,
+  0x40, 0x2a, 0x44, 0x04, 0x35, 0x50, 0x35, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x18,
+  0x45, 0x29, 0x19, 0x6b, 0x67, 0x10, 0x09, 0x63, 0x0f, 0x0d, 0x09, 0x37, 0x38, 0x62, 0x54, 0x6f,
+  0x63, 0x4a, 0x51, 0x6c, 0x5e, 0x6f, 0x2b, 0x3f, 0x61, 0x6d, 0x1c, 0x60, 0x2f, 0x01, 0x1f, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x46, 0x00, 0x54, 0x3e, 0x4e, 0x38, 0x52, 0x60, 0x00, 0x55, 0x50, 0x4b,
+  0x24, 0x71, 0x4f, 0x46, 0x09, 0x0b, 0x65, 0x13, 0x08, 0x35, 0x11, 0x09, 0x10, 0x01, 0x4a, 0x68,
+  0x6b, 0x31, 0x56, 0x1a, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4d, 0x42, 0x21, 0x3f, 0x15,
+  0x70, 0x2f, 0x63, 0x62, 0x09, 0x24, 0x37, 0x6e, 0x0a, 0x07, 0x00, 0x4e, 0x0a, 0x63, 0x28, 0x5f,
+  0x31, 0x50, 0x62, 0x5e, 0x19, 0x51, 0x36, 0x1e, 0x19, 0x1d, 0x1c, 0x01, 0x1f, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x4d, 0x03, 0x39, 0x3d, 0x30, 0x09, 0x31, 0x6f, 0x70, 0x26, 0x1e, 0x45, 0x6b, 0x0f,
+  0x1b, 0x00, 0x4e, 0x2d, 0x11, 0x3d, 0x2a, 0x30, 0x09, 0x48, 0x09, 0x30, 0x35, 0x55, 0x69, 0x30,
+  0x49, 0x18, 0x01, 0x1f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x41, 0x40, 0x57, 0x01, 0x51, 0x15,
+  0x56, 0x25, 0x64, 0x38, 0x4f, 0x32, 0x4d, 0x5d, 0x62, 0x21, 0x60, 0x27, 0x13, 0x15, 0x48, 0x6a,
+  0x48, 0x00, 0x45, 0x31, 0x47, 0x32, 0x03, 0x3c, 0x2c, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x5d, 0x42, 0x2b, 0x51, 0x03, 0x0e, 0x03, 0x6c, 0x04, 0x2a, 0x71, 0x54, 0x2e, 0x5b, 0x34, 0x3b,
+  0x16, 0x6a, 0x35, 0x64, 0x2c, 0x63, 0x65, 0x11, 0x19, 0x30, 0x22, 0x43, 0x15, 0x27, 0x31
+};
@@ -0,0 +1,64 @@
+/*
+  Demo sketch which plays a baked effect. The TwinkleFOX effect in
+  twinklefox.h was run on a computer by the wfxbake tool (in the library's
+  extras/tools folder), which saved its frames in a PROGMEM array:
+    wfxbake -p TwinkleFOX 30 twinklefox > twinklefox.h
+  The Baked custom effect plays the array back, so the board doesn't run
+  the TwinkleFOX effect itself, it just copies the frames to the LEDs. Any of
+  the library's effects can be baked this way, for boards that don't have
+  the effect, or don't have the time to run it.
+
+  Keith Lord - 2026
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+#include "custom/Baked.h"
+#include "twinklefox.h"
+
+#define LED_COUNT 30 // must match the number of LEDs the effect was baked for
+#define LED_PIN 5
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+void setup() {
+  ws2812fx.init();
+  ws2812fx.setBrightness(64);
+
+  // play the baked frames with the Baked custom effect
+  uint8_t bakedMode = ws2812fx.setCustomMode(F("Baked"), baked);
+  ws2812fx.setSegment(0, 0, LED_COUNT - 1, bakedMode, BLACK, 1000, NO_OPTIONS);
+  ws2812fx.setExtDataSrc(0, (uint8_t*)twinklefox, 1);
+
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+}
@@ -0,0 +1,78 @@
+/*
+  Demo sketch which shows how to play a long, pre-designed show from a file
+  with the clip effect. The clip is read from the LittleFS file system in
+  small blocks, so only a few hundred bytes of RAM are used however long the
+  show is.
+
+  Make the clip on your computer with the wfxclip tool in the library's
+  extras/tools folder, e.g. for 144 RGB LEDs and 25ms frames:
+    wfxclip encode -p -d 25 -k 100 144 show.raw show.wfx
+  and upload show.wfx to the board's LittleFS file system (put it in the
+  sketch's "data" folder and use the LittleFS upload tool).
+
+  The clip effect is only available on ESP boards.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+*/
+
+#include <LittleFS.h>
+#include <WS2812FX.h>
+#include <WS2812FXClip.h>
+
+#define LED_PIN    4   // digital pin used to drive the LED strip
+#define LED_COUNT 144  // number of LEDs on the strip
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+WS2812FXFileClip clip;
+
+void setup() {
+  Serial.begin(115200);
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(64);
+
+  if(LittleFS.begin() && clip.begin(LittleFS.open("/show.wfx", "r"))) {
+    Serial.printf("Playing a %u frame clip of %u LEDs\n", clip.getNumFrames(), clip.getNumLEDs());
+    ws2812fx.setSegment(0, 0, LED_COUNT-1, FX_MODE_CLIP, BLACK, 50, NO_OPTIONS);
+    ws2812fx.setExtDataSrc(0, (uint8_t*)&clip, 1);
+  } else { // no clip, so run a rainbow instead
+    Serial.println("Couldn't open /show.wfx");
+    ws2812fx.setSegment(0, 0, LED_COUNT-1, FX_MODE_RAINBOW_CYCLE, RED, 2000, NO_OPTIONS);
+  }
+
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+
+  // the segment's cycle flag is set each time the clip starts over
+  if(ws2812fx.isCycle(0) && ws2812fx.getMode(0) == FX_MODE_CLIP) {
+    Serial.println("Show restarted");
+  }
+}
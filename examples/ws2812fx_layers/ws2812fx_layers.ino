@@ -0,0 +1,59 @@
+/*
+  Demo sketch which shows how to stack effects on a segment with layers.
+  It does the same thing as the ws2812fx_overlay sketch, but with one
+  WS2812FX instance instead of three, so it uses a third of the memory.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN     4
+#define LED_COUNT 144
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+void setup() {
+  ws2812fx.init();
+  ws2812fx.setBrightness(64);
+
+  // the segment runs the background effect
+  ws2812fx.setSegment(0, 0, LED_COUNT-1, FX_MODE_RAINBOW_CYCLE, BLACK, 1000, NO_OPTIONS);
+
+  // layer 0 runs a larson scanner on top of the rainbow. The layer is
+  // added to the rainbow, so the scanner brightens the LEDs it passes over.
+  ws2812fx.setLayer(0, 0, FX_MODE_LARSON_SCANNER, WHITE, 5000, BLEND_ADD);
+  ws2812fx.setLayerOpacity(0, 128);
+
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+}
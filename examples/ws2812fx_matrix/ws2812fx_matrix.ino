@@ -1,86 +1,68 @@
-// Adafruit_NeoMatrix example for single NeoPixel Shield.
-// Scrolls 'Howdy' across the matrix in a portrait (vertical) orientation.
+// WS2812FXCanvas example for single NeoPixel Shield.
+// Scrolls 'Howdy' across the matrix in a portrait (vertical) orientation,
+// on top of a WS2812FX effect.
+//
+// The text is drawn with the Adafruit_GFX library, straight into the
+// WS2812FX pixel data, so there's no need for the Adafruit_NeoMatrix
+// library, a second pixel buffer or a second show().
 
 #include <Adafruit_GFX.h>
-#include <Adafruit_NeoMatrix.h>
-#include <Adafruit_NeoPixel.h>
+#include <WS2812FX.h>
+#include <WS2812FXCanvas.h>
 #ifndef PSTR
  #define PSTR // Make Arduino Due happy
 #endif
 
 #define PIN 4
 
-// MATRIX DECLARATION:
-// Parameter 1 = width of NeoPixel matrix
-// Parameter 2 = height of matrix
-// Parameter 3 = pin number (most are valid)
-// Parameter 4 = matrix layout flags, add together as needed:
-//   NEO_MATRIX_TOP, NEO_MATRIX_BOTTOM, NEO_MATRIX_LEFT, NEO_MATRIX_RIGHT:
-//     Position of the FIRST LED in the matrix; pick two, e.g.
-//     NEO_MATRIX_TOP + NEO_MATRIX_LEFT for the top-left corner.
-//   NEO_MATRIX_ROWS, NEO_MATRIX_COLUMNS: LEDs are arranged in horizontal
-//     rows or in vertical columns, respectively; pick one or the other.
-//   NEO_MATRIX_PROGRESSIVE, NEO_MATRIX_ZIGZAG: all rows/columns proceed
-//     in the same order, or alternate lines reverse direction; pick one.
-//   See example below for these values in action.
-// Parameter 5 = pixel type flags, add together as needed:
-//   NEO_KHZ800  800 KHz bitstream (most NeoPixel products w/WS2812 LEDs)
-//   NEO_KHZ400  400 KHz (classic 'v1' (not v2) FLORA pixels, WS2811 drivers)
-//   NEO_GRB     Pixels are wired for GRB bitstream (most NeoPixel products)
-//   NEO_GRBW    Pixels are wired for GRBW bitstream (RGB+W NeoPixel products)
-//   NEO_RGB     Pixels are wired for RGB bitstream (v1 FLORA pixels, not v2)
+// The NeoPixel Shield is a matrix of 8 x 5 LEDs, wired in rows, all rows
+// in the same (progressive) order. In this application we'd like to use it
+// as a 5x8 tall matrix, so the canvas is rotated a quarter turn.
+#define WIDTH  8
+#define HEIGHT 5
 
+WS2812FX ws2812fx = WS2812FX(WIDTH * HEIGHT, PIN, NEO_GRB + NEO_KHZ800);
+WS2812FXCanvas canvas = WS2812FXCanvas(ws2812fx, WIDTH, HEIGHT);
 
-// Example for NeoPixel Shield.  In this application we'd like to use it
-// as a 5x8 tall matrix, with the USB port positioned at the top of the
-// Arduino.  When held that way, the first pixel is at the top right, and
-// lines are arranged in columns, progressive order.  The shield uses
-// 800 KHz (v2) pixels that expect GRB color data.
-Adafruit_NeoMatrix matrix = Adafruit_NeoMatrix(5, 8, PIN,
-  NEO_MATRIX_TOP     + NEO_MATRIX_RIGHT +
-  NEO_MATRIX_COLUMNS + NEO_MATRIX_PROGRESSIVE,
-  NEO_GRB            + NEO_KHZ800);
 
-
-int16_t x = matrix.width();
+int16_t x = HEIGHT; // the canvas' width, once it's rotated
 uint8_t color_index = 0;
 char text[] = "Howdy";
 int scroll_limit = sizeof(text) * 6; // each text character is 6 pixels wide
 
 void setup() {
-  matrix.begin();
-  matrix.setTextWrap(false);
-  matrix.setBrightness(40);
-  matrix.setTextColor(matrix.Color(255, 0, 0)); // default color is red
+  ws2812fx.init();
+  ws2812fx.setBrightness(40);
+
+  // a dim twinkle effect in the background
+  ws2812fx.setSegment(0, 0, WIDTH * HEIGHT - 1, FX_MODE_TWINKLE, 0x000020, 1000, NO_OPTIONS);
+  ws2812fx.setMatrix(0, WIDTH, HEIGHT, MATRIX_PROGRESSIVE);
+
+  // the text is drawn by a custom effect, running as a layer on top of
+  // the background effect
+  ws2812fx.setCustomMode(scrollText);
+  ws2812fx.setLayer(0, 0, FX_MODE_CUSTOM, RED, 100, BLEND_MAX);
+
+  canvas.setRotation(1);
+  canvas.setTextWrap(false);
+  ws2812fx.start();
 }
 
 void loop() {
-  matrix.fillScreen(0);
-  matrix.setCursor(x, 0);
-  matrix.print(text);
+  ws2812fx.service();
+}
+
+uint16_t scrollText(void) {
+  canvas.fillScreen(0);
+  canvas.setCursor(x, 0);
+  uint32_t color = ws2812fx.color_wheel(color_index);
+  canvas.setTextColor(WS2812FXCanvas::Color(color >> 16, color >> 8, color));
+  canvas.print(text);
 
   if(--x < -scroll_limit) {
-    x = matrix.width();
+    x = canvas.width();
     color_index = 0; // reset the rainbow color index
   }
-  matrix.setTextColor(color_wheel(color_index));
   color_index += (256 / scroll_limit) > 1 ? (256 / scroll_limit) : 1;
-  matrix.show();
-  delay(100);
-}
-
-uint16_t color_wheel(uint8_t pos) {
-  pos = 255 - pos;
-  if(pos < 85) {
-//  return ((uint32_t)(255 - pos * 3) << 16) | ((uint32_t)(0) << 8) | (pos * 3);
-    return matrix.Color((uint16_t)(255 - pos * 3), 0, (pos * 3));
-  } else if(pos < 170) {
-    pos -= 85;
-//  return ((uint32_t)(0) << 16) | ((uint32_t)(pos * 3) << 8) | (255 - pos * 3);
-    return matrix.Color(0, (uint32_t)(pos * 3), (255 - pos * 3));
-  } else {
-    pos -= 170;
-//  return ((uint32_t)(pos * 3) << 16) | ((uint32_t)(255 - pos * 3) << 8) | (0);
-    return matrix.Color((uint16_t)(pos * 3), (uint32_t)(255 - pos * 3), 0);
-  }
+  return 100;
 }
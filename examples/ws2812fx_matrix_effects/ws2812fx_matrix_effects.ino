@@ -0,0 +1,89 @@
+/*
+  Demo sketch which shows how to lay a segment out as a 2D matrix. The
+  sketch cycles through the built-in matrix effects, and a custom effect that
+  uses the matrix helper functions, on an 8 x 8 LED matrix that's wired in a
+  serpentine pattern (every other row is wired right to left).
+
+  The built-in matrix effects are only available on ESP boards.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN    4  // digital pin used to drive the LED matrix
+#define WIDTH      8  // number of LEDs in each row
+#define HEIGHT     8  // number of rows
+#define LED_COUNT (WIDTH * HEIGHT)
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+uint8_t modes[] = { FX_MODE_MATRIX_RAIN, FX_MODE_PLASMA, FX_MODE_MATRIX_FIRE, FX_MODE_MATRIX_SCROLL, FX_MODE_CUSTOM };
+uint8_t modeIndex = 0;
+unsigned long lastTime = 0;
+
+void setup() {
+  ws2812fx.init();
+  ws2812fx.setBrightness(64);
+  ws2812fx.setCustomMode(rainbowCurtain);
+  ws2812fx.setSegment(0, 0, LED_COUNT-1, modes[modeIndex], COLORS(GREEN, BLACK), 1000, NO_OPTIONS);
+
+  // the effects draw the matrix in rows, left to right and top to bottom.
+  // The output stage takes care of the rows that are wired right to left.
+  ws2812fx.setMatrix(0, WIDTH, HEIGHT, MATRIX_SERPENTINE);
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+
+  // change effects every 10 seconds
+  if(millis() - lastTime > 10000) {
+    modeIndex = (modeIndex + 1) % sizeof(modes);
+    ws2812fx.setMode(modes[modeIndex]);
+    lastTime = millis();
+  }
+}
+
+// a custom effect that rolls a rainbow curtain down the matrix, one row at a
+// time, and then rolls it back up again
+uint16_t rainbowCurtain(void) {
+  WS2812FX::Segment_runtime* segrt = ws2812fx.getSegmentRuntime();
+  uint16_t height = ws2812fx.getMatrixHeight();
+
+  // scroll the curtain down (or up), then draw its bottom row
+  uint16_t step = segrt->counter_mode_step % (height * 2 - 2);
+  bool goingDown = step < height - 1;
+  uint16_t y = goingDown ? step : (height * 2 - 2) - step;
+  ws2812fx.scrollMatrix(0, goingDown ? 1 : -1);
+  ws2812fx.fillRow(y, ws2812fx.color_wheel(segrt->counter_mode_step * 8));
+
+  segrt->counter_mode_step++;
+  return 100;
+}
@@ -0,0 +1,69 @@
+/*
+  Demo sketch which shows how to send one strip's pixel data to several
+  physical LED strips, each driven by its own GPIO pin. One effect is spread
+  across three strips: the second strip is mounted back to front, and the
+  third strip is an RGBW strip.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN_1    10  // digital pins used to drive the physical LED strips
+#define LED_PIN_2    11
+#define LED_PIN_3    12
+#define LED_COUNT_1  30  // number of LEDs on each physical strip
+#define LED_COUNT_2  30
+#define LED_COUNT_3  20
+
+// the WS2812FX strip holds the pixel data of all the physical strips. Its
+// pin isn't used once outputs are set.
+WS2812FX ws2812fx = WS2812FX(LED_COUNT_1 + LED_COUNT_2 + LED_COUNT_3, LED_PIN_1, NEO_GRB + NEO_KHZ800);
+
+void setup() {
+  ws2812fx.init();
+  ws2812fx.setBrightness(255);
+  ws2812fx.setSegment(0, 0, ws2812fx.getLength()-1, FX_MODE_COMET, RED, 2000, NO_OPTIONS);
+
+  // the first strip sends its part of the pixel data directly, since it
+  // has the same pixel type as the WS2812FX strip
+  ws2812fx.setOutput(0, LED_PIN_1, 0, LED_COUNT_1, NEO_GRB + NEO_KHZ800);
+
+  // the second strip is mounted back to front, so its pixel data is reversed
+  ws2812fx.setOutput(1, LED_PIN_2, LED_COUNT_1, LED_COUNT_2, NEO_GRB + NEO_KHZ800, REVERSE);
+
+  // the third strip is an RGBW strip, so its pixel data is converted
+  ws2812fx.setOutput(2, LED_PIN_3, LED_COUNT_1 + LED_COUNT_2, LED_COUNT_3, NEO_GRBW + NEO_KHZ800);
+
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+}
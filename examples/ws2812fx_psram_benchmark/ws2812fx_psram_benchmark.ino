@@ -0,0 +1,97 @@
+/*
+  Benchmark sketch which times each effect with the strip's buffers in
+  internal RAM and in PSRAM. Every mode is timed with each of the four memory
+  policies: PSRAM_NONE (all buffers in internal RAM), PSRAM_PIXELS (the pixel
+  data the effects render into in PSRAM), PSRAM_BUFFERS (the output stage
+  buffer in PSRAM) and PSRAM_ALL.
+
+  Segment brightness is used, so the output stage is running. A do-nothing
+  custom show function is used, so the time includes copying pixel data that's
+  in PSRAM to the staging buffer in internal RAM, but not sending it to the LEDs.
+
+  This sketch is meant to be run on an ESP32 with PSRAM. On other boards all
+  four policies put the buffers in internal RAM.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN      4
+#define LED_COUNT 2000
+#define NUM_CALLS  100 // number of service() calls timed for each mode
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+const uint8_t policies[] = {PSRAM_NONE, PSRAM_PIXELS, PSRAM_BUFFERS, PSRAM_ALL};
+
+void setup() {
+  Serial.begin(115200);
+  delay(500);
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(255);
+  ws2812fx.setSegmentBrightness(0, 200); // start the output stage
+  ws2812fx.setCustomShow(myCustomShow);
+  ws2812fx.start();
+
+  Serial.println(F("mode                        none  pixels buffers     all (us per frame)"));
+  for(uint8_t m=0; m < ws2812fx.getModeCount(); m++) {
+    Serial.printf("%-24s", (const char*)ws2812fx.getModeName(m));
+    for(uint8_t i=0; i < sizeof(policies); i++) {
+      ws2812fx.setMemoryPolicy(policies[i]);
+      ws2812fx.setMode(m);
+      Serial.printf(" %7lu", timeCalls());
+    }
+    Serial.println();
+  }
+
+  // where the buffers ended up with the last policy
+  Serial.printf("pixel data in %s\n", WS2812FX::isPSRAM(ws2812fx.getPixels()) ? "PSRAM" : "internal RAM");
+}
+
+void loop() {
+}
+
+unsigned long timeCalls() {
+  ws2812fx.resetSegmentRuntimes();
+  ws2812fx.trigger();
+  ws2812fx.service(); // run the mode once before timing
+
+  unsigned long start = micros();
+  for(uint16_t i=0; i < NUM_CALLS; i++) {
+    ws2812fx.trigger(); // run the mode on every call, whatever its speed
+    ws2812fx.service();
+  }
+  return (micros() - start) / NUM_CALLS;
+}
+
+void myCustomShow(void) {
+  // don't send the pixel data anywhere, only service() and the staging copy are being timed
+}
@@ -0,0 +1,104 @@
+/*
+  Benchmark sketch which compares the cost of remapping the pixel data of a
+  large, 100 x 100 LED serpentine matrix with a remap table, and with a
+  run-length encoded remap table. The serpentine layout needs one entry per
+  LED in the remap table, but only one run per row in the run-length encoded
+  table.
+
+  The 10,000 LED strip needs about 110KB of RAM, so this sketch is meant to
+  be run on an ESP32. A do-nothing custom show function is used, so only the
+  time spent in the output stage is measured.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN    4
+#define WIDTH    100
+#define HEIGHT   100
+#define LED_COUNT (WIDTH * HEIGHT)
+#define NUM_SHOWS 100 // number of shows timed for each test
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+// remap table, the pixel shown on each LED
+uint16_t remapTable[LED_COUNT];
+
+// run-length encoded remap table, one run per row
+WS2812FX::remap_run remapRuns[HEIGHT];
+
+void setup() {
+  Serial.begin(115200);
+  delay(500);
+
+  // every other row of the matrix is wired right to left
+  for(uint16_t y=0; y < HEIGHT; y++) {
+    for(uint16_t x=0; x < WIDTH; x++) {
+      remapTable[y * WIDTH + x] = (y % 2 == 0) ? y * WIDTH + x : y * WIDTH + (WIDTH - 1 - x);
+    }
+    remapRuns[y] = { (uint16_t)(y * WIDTH), WIDTH, (uint8_t)((y % 2 == 0) ? NO_OPTIONS : REVERSE) };
+  }
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(255);
+  ws2812fx.setSegment(0, 0, LED_COUNT-1, FX_MODE_RAINBOW_CYCLE, RED, 1000, NO_OPTIONS);
+  ws2812fx.setCustomShow(myCustomShow);
+  // setting the segment brightness starts the output stage, so the time
+  // without a remap table includes the rest of the output stage
+  ws2812fx.setSegmentBrightness(0, 255);
+  ws2812fx.start();
+  ws2812fx.service();
+
+  Serial.printf("No remap:         %lu us per show\n", timeShows());
+
+  ws2812fx.setRemap(remapTable, LED_COUNT);
+  Serial.printf("Remap table:      %lu us per show, %u bytes\n", timeShows(), sizeof(remapTable));
+
+  ws2812fx.setRemap(remapRuns, HEIGHT);
+  Serial.printf("Run-length table: %lu us per show, %u bytes\n", timeShows(), sizeof(remapRuns));
+
+  ws2812fx.removeRemap();
+}
+
+void loop() {
+}
+
+unsigned long timeShows() {
+  ws2812fx.execShow(); // allocate the output buffers before timing
+  unsigned long start = micros();
+  for(uint16_t i=0; i < NUM_SHOWS; i++) {
+    ws2812fx.execShow();
+  }
+  return (micros() - start) / NUM_SHOWS;
+}
+
+void myCustomShow(void) {
+  // don't send the pixel data anywhere, only the output stage is being timed
+}
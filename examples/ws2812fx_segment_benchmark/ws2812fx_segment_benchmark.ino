@@ -0,0 +1,108 @@
+/*
+  Benchmark sketch which times service() on a strip split into 10, 100, 1000
+  and 5000 segments. Each size is timed three times: with every segment idle,
+  which is the scheduling overhead of checking which segments are due, with
+  every segment running as often as it can, and running with dedupe enabled
+  (half the segments are red and half are blue, so all but two are copies).
+
+  The segments need about 52 bytes of RAM each, so this sketch is meant to be
+  run on an ESP32 (5000 segments need a board with PSRAM). A do-nothing custom
+  show function is used, so only the time spent in service() is measured.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN      4
+#define LED_COUNT 5000
+#define NUM_CALLS 1000 // number of service() calls timed for each test
+
+#if defined(BOARD_HAS_PSRAM)
+  #define MAX_SEGMENTS 5000 // the large segment arrays are put in PSRAM
+#else
+  #define MAX_SEGMENTS 2000 // the largest array (the segment runtimes) must fit in one block of internal RAM
+#endif
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800, MAX_SEGMENTS, MAX_SEGMENTS);
+
+const uint16_t sizes[] = {10, 100, 1000, 5000};
+
+void setup() {
+  Serial.begin(115200);
+  delay(500);
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(255);
+  ws2812fx.setCustomShow(myCustomShow);
+  ws2812fx.start();
+
+  for(uint8_t i=0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    uint16_t numSegments = sizes[i];
+    if(numSegments > MAX_SEGMENTS) {
+      Serial.printf("%4u segments: not enough RAM\n", numSegments);
+      continue;
+    }
+    setupSegments(numSegments, 60000); // the segments run once, then wait a minute
+    unsigned long idle = timeCalls();
+    setupSegments(numSegments, SPEED_MIN);
+    unsigned long busy = timeCalls();
+    ws2812fx.setDedupe(true);
+    setupSegments(numSegments, SPEED_MIN);
+    unsigned long deduped = timeCalls();
+    ws2812fx.setDedupe(false);
+    Serial.printf("%4u segments: %6lu us per service() idle, %6lu us busy, %6lu us deduped\n", numSegments, idle, busy, deduped);
+  }
+}
+
+void loop() {
+}
+
+// split the strip into numSegments segments of (nearly) equal length
+void setupSegments(uint16_t numSegments, uint16_t speed) {
+  ws2812fx.resetSegments();
+  for(uint16_t n=0; n < numSegments; n++) {
+    uint16_t start = (uint32_t)n * LED_COUNT / numSegments;
+    uint16_t stop = (uint32_t)(n + 1) * LED_COUNT / numSegments - 1;
+    ws2812fx.setSegment(n, start, stop, FX_MODE_STATIC, n % 2 ? RED : BLUE, speed, NO_OPTIONS);
+  }
+  ws2812fx.service(); // run every segment once before timing
+}
+
+unsigned long timeCalls() {
+  unsigned long start = micros();
+  for(uint16_t i=0; i < NUM_CALLS; i++) {
+    ws2812fx.service();
+  }
+  return (micros() - start) / NUM_CALLS;
+}
+
+void myCustomShow(void) {
+  // don't send the pixel data anywhere, only service() is being timed
+}
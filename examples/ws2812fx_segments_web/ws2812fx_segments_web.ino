@@ -36,6 +36,7 @@
   2017-10-02 initial version
   2017-10-08 added web interface
   2021-04-02 major rewrite to make the app self-contained (does not pull resources off the Internet).
+  2026-10-19 use automatic transitions, instead of blanking the strip, when only the segments change
 
 */
 #define DYNAMIC_JSON_DOCUMENT_SIZE  2048 /* used by AsyncJson. Default is 1024, which is a little too small */
@@ -124,6 +125,9 @@ void setup() {
 
   // init LED strip with a default segment
   ws2812fx.init();
+  for (int i = 0; i < MAX_NUM_SEGMENTS; i++) {
+    ws2812fx.setAutoTransition(i, 1000, TRANSITION_FADE);
+  }
   updateWs2812fx();
 
   // if segment data had been previously saved to eeprom, load that data
@@ -285,6 +289,25 @@ void showReqParams(AsyncWebServerRequest * request) {
 }
 
 void updateWs2812fx() {
+  // if only the segments' modes, colors, speeds or options have changed,
+  // update them in place and let the automatic transitions blend the old
+  // effects into the new ones
+  bool segmentsMatch = ws2812fx.isRunning() &&
+    preset.numPixels == ws2812fx.getLength() && preset.pin == ws2812fx.getPin() &&
+    preset.numSegments == ws2812fx.getNumSegments();
+  for (int i = 0; segmentsMatch && i < preset.numSegments; i++) {
+    WS2812FX::Segment* seg = ws2812fx.getSegment(i);
+    segmentsMatch = preset.segments[i].start == seg->start && preset.segments[i].stop == seg->stop;
+  }
+  if (segmentsMatch) {
+    ws2812fx.setBrightness(preset.brightness);
+    for (int i = 0; i < preset.numSegments; i++) {
+      WS2812FX::Segment seg = preset.segments[i];
+      ws2812fx.setSegment(i, seg.start, seg.stop, seg.mode, seg.colors, seg.speed, seg.options);
+    }
+    return;
+  }
+
   ws2812fx.stop();
   ws2812fx.strip_off();
   ws2812fx.setLength(preset.numPixels);
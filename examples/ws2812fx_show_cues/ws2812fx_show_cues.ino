@@ -0,0 +1,89 @@
+/*
+  WS2812FX show cues demo. Runs the segment sequence demo as a list of cues,
+  so the sketch's loop() only needs to call service().
+
+  FEATURES
+    * example of a looping cue list
+    * example of time based and cycle based cues
+    * example of transitions between cues
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+  
+  CHANGELOG
+  2026-10-19 initial version
+  
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN    10  // digital pin used to drive the LED strip
+#define LED_COUNT 144  // number of LEDs on the strip
+
+#define NUM_SEGMENTS        5  // maximum total number of segments that can be created
+#define NUM_ACTIVE_SEGMENTS 2  // maximum number of segments that can be actively running
+
+// create helper macros that define the start and end LEDs for each of our two segments
+#define LOWER_SEG_RANGE 0, LED_COUNT/2 - 1
+#define UPPER_SEG_RANGE LED_COUNT/2, LED_COUNT - 1
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800, NUM_SEGMENTS, NUM_ACTIVE_SEGMENTS);
+
+// the show: first segment, number of segments, duration, CUE_MS or CUE_CYCLES, transition (ms), transition style
+const WS2812FX::show_cue cues[] = {
+  {0, 2, 10000, CUE_MS,     0,    0},                              // seg[0] and seg[1] for 10 seconds
+  {2, 2, 5,     CUE_CYCLES, 1000, TRANSITION_FADE},                // seg[2] and seg[3] for 5 blinks of seg[2]
+  {4, 1, 8000,  CUE_MS,     2000, TRANSITION_WIPE | EASE_IN_OUT}   // seg[4] for 8 seconds
+};
+
+void setup() {
+  Serial.begin(115200);
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(32);
+
+  // create all the segments up front, the cues decide which of them run
+  ws2812fx.setSegment    (0, LOWER_SEG_RANGE, FX_MODE_BLINK, YELLOW,             2000, NO_OPTIONS);
+  ws2812fx.setSegment    (1, UPPER_SEG_RANGE, FX_MODE_BLINK, COLORS(RED, GREEN), 2000, NO_OPTIONS);
+  ws2812fx.setIdleSegment(2, LOWER_SEG_RANGE, FX_MODE_BLINK, CYAN,               2000, NO_OPTIONS);
+  ws2812fx.setIdleSegment(3, UPPER_SEG_RANGE, FX_MODE_BLINK, COLORS(PINK, BLUE), 2000, NO_OPTIONS);
+  ws2812fx.setIdleSegment(4, 0, LED_COUNT - 1, FX_MODE_RAINBOW_CYCLE, RED,       1000, NO_OPTIONS);
+
+  ws2812fx.setCues(cues, sizeof(cues) / sizeof(cues[0]), true); // loop forever
+
+  ws2812fx.start();
+}
+
+void loop() {
+  static uint8_t cue = NO_CUE;
+
+  ws2812fx.service();
+
+  if(ws2812fx.getCue() != cue) {
+    cue = ws2812fx.getCue();
+    Serial.print(F("cue ")); Serial.println(cue);
+  }
+}
@@ -0,0 +1,100 @@
+/*
+  Demo sketch which shows how to run spatial effects on LEDs that aren't in
+  a line or a grid. The LEDs are wrapped in a spiral around a cone shaped
+  "tree", and the position of each LED is worked out in setup(). The sketch
+  cycles through the built-in spatial effects, and a custom effect that uses
+  getNeighbors() to light up LEDs that are close to each other.
+
+  The built-in spatial effects are only available on ESP boards.
+
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026  Keith Lord 
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+  
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#include <WS2812FX.h>
+
+#define LED_PIN    4   // digital pin used to drive the LED strip
+#define LED_COUNT 200  // number of LEDs wrapped around the tree
+#define TURNS      10  // number of times the LED strip goes around the tree
+
+WS2812FX ws2812fx = WS2812FX(LED_COUNT, LED_PIN, NEO_GRB + NEO_KHZ800);
+
+// the position of each LED. x and y are across the tree, z is up the tree.
+WS2812FX::led_position positions[LED_COUNT];
+
+uint8_t modes[] = { FX_MODE_PLANE_SWEEP, FX_MODE_SPHERES, FX_MODE_NOISE_FIELD, FX_MODE_SPATIAL_WIPE, FX_MODE_CUSTOM };
+uint8_t modeIndex = 0;
+unsigned long lastTime = 0;
+
+void setup() {
+  // work out the LED positions. The strip starts at the bottom of the tree,
+  // and the tree gets narrower towards the top.
+  for(uint16_t i=0; i < LED_COUNT; i++) {
+    float height = (float)i / LED_COUNT;     // 0 at the bottom, 1 at the top
+    float angle = height * TURNS * 2 * PI;
+    float radius = 127 * (1 - height);
+    positions[i].x = (int8_t)(radius * cos(angle));
+    positions[i].y = (int8_t)(radius * sin(angle));
+    positions[i].z = (int8_t)(height * 255 - 128);
+  }
+
+  ws2812fx.init();
+  ws2812fx.setBrightness(64);
+  ws2812fx.setPositions(positions, LED_COUNT);
+  ws2812fx.setSpatialDirection(0, 0, 127); // sweep and wipe up the tree
+  ws2812fx.setCustomMode(sparks);
+  ws2812fx.setSegment(0, 0, LED_COUNT-1, modes[modeIndex], COLORS(GREEN, RED), 2000, SIZE_MEDIUM);
+  ws2812fx.start();
+}
+
+void loop() {
+  ws2812fx.service();
+
+  // change effects every 10 seconds
+  if(millis() - lastTime > 10000) {
+    modeIndex = (modeIndex + 1) % sizeof(modes);
+    ws2812fx.setMode(modes[modeIndex]);
+    lastTime = millis();
+  }
+}
+
+// a custom effect that lights a random LED, and the LEDs around it, even
+// if they're on a different turn of the spiral
+uint16_t sparks(void) {
+  static uint16_t neighbors[32];
+
+  ws2812fx.fade_out();
+  uint16_t n = ws2812fx.random16(LED_COUNT);
+  uint32_t color = ws2812fx.color_wheel(ws2812fx.random8());
+  uint16_t count = ws2812fx.getNeighbors(n, 24, neighbors, 32);
+  ws2812fx.setPixelColor(n, color);
+  for(uint16_t i=0; i < count; i++) {
+    ws2812fx.setPixelColor(neighbors[i], color);
+  }
+  return 200;
+}
@@ -0,0 +1,77 @@
+/*
+  clip_writer.h - builds WS2812FX animation clips, for the tools in the
+  extras/tools folder. See src/clip_codec.h for the clip format.
+*/
+#ifndef clip_writer_h
+#define clip_writer_h
+
+#include <stdio.h>
+#include <vector>
+#include "../../src/clip_codec.h"
+
+/*
+ * Encodes frames, the R, G, B[, W] bytes of each LED of each frame, and a
+ * delay for each frame, as a clip. h holds the number of LEDs, the bytes per
+ * pixel, and the CLIP_PALETTE flag if the colors should be stored in a
+ * palette. Every keyInterval'th frame is a keyframe (0 = only the first).
+ * Returns false, after printing why, if the frames can't be encoded.
+ */
+static bool clipBuild(clip_header h, std::vector<uint8_t> frames, const std::vector<uint16_t>& delays,
+  uint32_t keyInterval, std::vector<uint8_t>& clip) {
+  size_t frameSize = h.numLEDs * h.bytesPerPixel;
+  h.numFrames = frames.size() / frameSize;
+  h.paletteSize = 0;
+  if(h.numFrames == 0 || delays.size() != h.numFrames) {
+    fprintf(stderr, "a clip needs at least one frame, and a delay for each frame\n");
+    return false;
+  }
+
+  // replace the colors with palette indexes
+  uint8_t colorSize = h.bytesPerPixel;
+  std::vector<uint8_t> palette;
+  if(h.flags & CLIP_PALETTE) {
+    std::vector<uint8_t> indexes(h.numFrames * h.numLEDs);
+    for(size_t n=0; n < indexes.size(); n++) {
+      const uint8_t* color = &frames[n * h.bytesPerPixel];
+      size_t index = 0;
+      while(index < h.paletteSize && memcmp(&palette[index * h.bytesPerPixel], color, h.bytesPerPixel) != 0) index++;
+      if(index == h.paletteSize) {
+        if(h.paletteSize == 256) {
+          fprintf(stderr, "the frames have more than 256 colors, so can't use a palette\n");
+          return false;
+        }
+        palette.insert(palette.end(), color, color + h.bytesPerPixel);
+        h.paletteSize++;
+      }
+      indexes[n] = index;
+    }
+    frames.swap(indexes);
+    colorSize = 1;
+    frameSize = h.numLEDs;
+  }
+
+  clip.resize(CLIP_HEADER_SIZE);
+  clipWriteHeader(clip.data(), &h);
+  clip.insert(clip.end(), palette.begin(), palette.end());
+
+  std::vector<uint8_t> payload(clipMaxPayload(h.numLEDs, colorSize));
+  for(uint32_t n=0; n < h.numFrames; n++) {
+    bool isKeyframe = n == 0 || (keyInterval && n % keyInterval == 0);
+    const uint8_t* frame = &frames[n * frameSize];
+    clip_frame f;
+    f.type = isKeyframe ? CLIP_KEYFRAME : CLIP_DELTA;
+    f.delay = delays[n];
+    f.size = clipEncode(frame, isKeyframe ? NULL : frame - frameSize, h.numLEDs, colorSize, payload.data());
+
+    uint8_t buf[CLIP_FRAME_HEADER_SIZE];
+    clipWriteFrame(buf, &f);
+    clip.insert(clip.end(), buf, buf + CLIP_FRAME_HEADER_SIZE);
+    clip.insert(clip.end(), payload.begin(), payload.begin() + f.size);
+  }
+
+  fprintf(stderr, "%u frames of %u LEDs, %u palette colors: %zu bytes, %.1f%% of the frames\n",
+    h.numFrames, h.numLEDs, h.paletteSize, clip.size(), 100.0 * clip.size() / (frames.size() * (h.bytesPerPixel / colorSize)));
+  return true;
+}
+
+#endif
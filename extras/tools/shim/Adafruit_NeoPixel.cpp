@@ -0,0 +1,137 @@
+/*
+  Adafruit_NeoPixel.cpp - a host stand-in for the Adafruit_NeoPixel library,
+  and the Arduino functions declared in Arduino.h.
+*/
+#include <Adafruit_NeoPixel.h>
+
+unsigned long shimMillis = 0;
+void (*shimShowHook)(const Adafruit_NeoPixel* strip) = NULL;
+
+unsigned long millis(void) { return shimMillis; }
+unsigned long micros(void) { return shimMillis * 1000; }
+void delay(unsigned long) {} // time only passes when the tools change shimMillis
+void yield(void) {}
+long random(long howbig) { return howbig ? rand() % howbig : 0; }
+long random(long howsmall, long howbig) { return howbig > howsmall ? howsmall + rand() % (howbig - howsmall) : howsmall; }
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
+  : begun(false), numLEDs(0), numBytes(0), pin(p), brightness(0), pixels(NULL), endTime(0) {
+  updateType(t);
+  updateLength(n);
+}
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(void)
+  : is800KHz(true), begun(false), numLEDs(0), numBytes(0), pin(-1), brightness(0), pixels(NULL),
+    rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0) {
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+  free(pixels);
+}
+
+void Adafruit_NeoPixel::begin(void) {
+  begun = true;
+}
+
+void Adafruit_NeoPixel::updateLength(uint16_t n) {
+  free(pixels);
+  numBytes = n * ((wOffset == rOffset) ? 3 : 4);
+  if((pixels = (uint8_t*)malloc(numBytes))) {
+    memset(pixels, 0, numBytes);
+    numLEDs = n;
+  } else {
+    numLEDs = numBytes = 0;
+  }
+}
+
+void Adafruit_NeoPixel::updateType(neoPixelType t) {
+  bool oldThreeBytesPerPixel = (wOffset == rOffset);
+  wOffset = (t >> 6) & 0b11;
+  rOffset = (t >> 4) & 0b11;
+  gOffset = (t >> 2) & 0b11;
+  bOffset = t & 0b11;
+  is800KHz = (t < 256);
+  if(pixels && (wOffset == rOffset) != oldThreeBytesPerPixel) updateLength(numLEDs);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  setPixelColor(n, r, g, b, 0);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+  if(n >= numLEDs) return;
+  if(brightness) {
+    r = (r * brightness) >> 8;
+    g = (g * brightness) >> 8;
+    b = (b * brightness) >> 8;
+    w = (w * brightness) >> 8;
+  }
+  uint8_t* p;
+  if(wOffset == rOffset) {
+    p = &pixels[n * 3];
+  } else {
+    p = &pixels[n * 4];
+    p[wOffset] = w;
+  }
+  p[rOffset] = r;
+  p[gOffset] = g;
+  p[bOffset] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
+  setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c, (uint8_t)(c >> 24));
+}
+
+void Adafruit_NeoPixel::fill(uint32_t c, uint16_t first, uint16_t count) {
+  if(first >= numLEDs) return;
+  uint16_t end = (count == 0 || first + count > numLEDs) ? numLEDs : first + count;
+  for(uint16_t i=first; i < end; i++) setPixelColor(i, c);
+}
+
+void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+  uint8_t newBrightness = b + 1;
+  if(newBrightness == brightness) return;
+  uint8_t oldBrightness = brightness - 1;
+  uint16_t scale;
+  if(oldBrightness == 0) scale = 0;
+  else if(b == 255) scale = 65535 / oldBrightness;
+  else scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+  for(uint16_t i=0; i < numBytes; i++) pixels[i] = (pixels[i] * scale) >> 8;
+  brightness = newBrightness;
+}
+
+void Adafruit_NeoPixel::clear(void) {
+  memset(pixels, 0, numBytes);
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+  if(n >= numLEDs) return 0;
+  const uint8_t* p = (wOffset == rOffset) ? &pixels[n * 3] : &pixels[n * 4];
+  uint32_t w = (wOffset == rOffset) ? 0 : p[wOffset];
+  uint32_t r = p[rOffset], g = p[gOffset], b = p[bOffset];
+  if(brightness) {
+    w = (w << 8) / brightness;
+    r = (r << 8) / brightness;
+    g = (g << 8) / brightness;
+    b = (b << 8) / brightness;
+  }
+  return (w << 24) | (r << 16) | (g << 8) | b;
+}
+
+// the real library uses tables, made with these formulas
+uint8_t Adafruit_NeoPixel::sine8(uint8_t x) {
+  return (uint8_t)(127.5 + 127.5 * sin(x * 2 * M_PI / 256) + 0.5);
+}
+
+uint8_t Adafruit_NeoPixel::gamma8(uint8_t x) {
+  return (uint8_t)(pow(x / 255.0, 2.6) * 255.0 + 0.5);
+}
+
+uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
+  uint8_t* y = (uint8_t*)&x;
+  for(uint8_t i=0; i < 4; i++) y[i] = gamma8(y[i]);
+  return x;
+}
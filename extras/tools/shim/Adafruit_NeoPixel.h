@@ -0,0 +1,73 @@
+/*
+  Adafruit_NeoPixel.h - a host stand-in for the Adafruit_NeoPixel library,
+  for the tools in the extras/tools folder. It keeps the pixel data the same
+  way the real library does, but show() doesn't send it anywhere. Tools can
+  set shimShowHook to look at the pixel data each show() would have sent.
+*/
+#ifndef ADAFRUIT_NEOPIXEL_H
+#define ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+#define NEO_RGB  ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB  ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGBW ((3 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRBW ((3 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel;
+extern void (*shimShowHook)(const Adafruit_NeoPixel* strip);
+
+class Adafruit_NeoPixel {
+  public:
+    Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+    Adafruit_NeoPixel(void);
+    ~Adafruit_NeoPixel();
+
+    void begin(void);
+    void show(void) { if(shimShowHook != NULL) shimShowHook(this); }
+    void setPin(int16_t p) { pin = p; }
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+    void setPixelColor(uint16_t n, uint32_t c);
+    void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+    void setBrightness(uint8_t);
+    void clear(void);
+    void updateLength(uint16_t n);
+    void updateType(neoPixelType t);
+    bool canShow(void) { return true; }
+    uint8_t* getPixels(void) const { return pixels; }
+    uint8_t getBrightness(void) const { return brightness - 1; }
+    int16_t getPin(void) const { return pin; }
+    uint16_t numPixels(void) const { return numLEDs; }
+    uint32_t getPixelColor(uint16_t n) const;
+
+    static uint8_t sine8(uint8_t x);
+    static uint8_t gamma8(uint8_t x);
+    static uint32_t gamma32(uint32_t x);
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+      return ((uint32_t)w << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+  protected:
+    bool is800KHz;
+    bool begun;
+    uint16_t numLEDs;
+    uint16_t numBytes;
+    int16_t pin;
+    uint8_t brightness;
+    uint8_t* pixels;
+    uint8_t rOffset;
+    uint8_t gOffset;
+    uint8_t bOffset;
+    uint8_t wOffset;
+    uint32_t endTime;
+};
+
+#endif
@@ -0,0 +1,42 @@
+/*
+  Arduino.h - just enough of the Arduino API to build the WS2812FX library
+  on a host computer, for the tools in the extras/tools folder.
+
+  millis() returns shimMillis, which the tools set to simulate time passing.
+*/
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stddef.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+#define pgm_read_dword(a) (*(const uint32_t*)(a))
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper*)(s))
+
+extern unsigned long shimMillis;
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long);
+void yield(void);
+long random(long);
+long random(long, long);
+long map(long, long, long, long, long);
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+template<class T, class L> auto min(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (b < a) ? b : a; }
+template<class T, class L> auto max(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (a < b) ? b : a; }
+
+#endif
@@ -0,0 +1,196 @@
+/*
+  wfxbake.cpp - bakes WS2812FX effects into PROGMEM clips
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  Runs one of the library's effects on the host computer, and writes the
+  frames it renders as a clip in a C array, which the Baked custom effect
+  (src/custom/Baked.h) plays on boards that don't have the effect, or don't
+  have the time to run it.
+
+  Builds on the host computer, not the microcontroller, with the stand-in
+  Arduino and Adafruit_NeoPixel files in the shim folder:
+    g++ -O2 -DESP32 -Ishim -I../../src -o wfxbake wfxbake.cpp shim/Adafruit_NeoPixel.cpp "../../src/"*.cpp
+  (ESP32 is defined so all the effects are built.)
+
+  Usage:
+    wfxbake [options] <mode> <LEDs> <name> > <name>.h
+      mode is the effect's number or name, e.g. 55 or "TwinkleFOX"
+      -c <RRGGBB>  a segment color, up to three (default FF0000)
+      -s <speed>   the segment's speed (default 1000)
+      -o <options> the segment's options, e.g. 0x80 for REVERSE (default 0)
+      -w           RGBW LEDs
+      -p           store the colors in a palette (256 colors max)
+      -n <frames>  bake exactly this many frames, instead of baking until
+                   the effect repeats itself (1000 frames max)
+      -k <n>       make every nth frame a keyframe (default 0, only the first)
+      -r <seed>    the random number seed
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#include <stdio.h>
+#include <strings.h>
+#include <WS2812FX.h>
+#include "clip_writer.h"
+
+#define MAX_FRAMES 1000
+
+static int usage(void) {
+  fprintf(stderr, "usage: wfxbake [-c RRGGBB] [-s speed] [-o options] [-w] [-p] [-n frames] [-k n] [-r seed] <mode> <LEDs> <name>\n");
+  return 2;
+}
+
+// returns true if two runtimes are at the same point, ignoring the time, call count, frame and cycle flags
+static bool isSameState(const WS2812FX::segment_runtime* a, const WS2812FX::segment_runtime* b) {
+  return a->counter_mode_step == b->counter_mode_step &&
+    a->aux_param == b->aux_param &&
+    ((a->aux_param2 ^ b->aux_param2) & ~(FRAME | CYCLE)) == 0 &&
+    a->aux_param3 == b->aux_param3 &&
+    a->head == b->head;
+}
+
+int main(int argc, char** argv) {
+  uint32_t colors[MAX_NUM_COLORS] = {RED, BLACK, BLACK};
+  uint8_t numColors = 0;
+  uint16_t speed = DEFAULT_SPEED;
+  uint8_t options = NO_OPTIONS;
+  clip_header h = {};
+  h.bytesPerPixel = 3;
+  uint32_t numFrames = 0, keyInterval = 0;
+  bool isRGBW = false;
+
+  int i = 1;
+  for(; i < argc && argv[i][0] == '-'; i++) {
+    char opt = argv[i][1];
+    if(opt == 'w') isRGBW = true;
+    else if(opt == 'p') h.flags |= CLIP_PALETTE;
+    else if(i + 1 >= argc) return usage();
+    else if(opt == 'c' && numColors < MAX_NUM_COLORS) colors[numColors++] = strtoul(argv[++i], NULL, 16);
+    else if(opt == 's') speed = strtoul(argv[++i], NULL, 0);
+    else if(opt == 'o') options = strtoul(argv[++i], NULL, 0);
+    else if(opt == 'n') numFrames = strtoul(argv[++i], NULL, 0);
+    else if(opt == 'k') keyInterval = strtoul(argv[++i], NULL, 0);
+    else if(opt == 'r') srand(strtoul(argv[++i], NULL, 0));
+    else return usage();
+  }
+  if(argc - i != 3) return usage();
+  if(isRGBW) h.bytesPerPixel = 4;
+
+  long numLEDs = atol(argv[i + 1]);
+  if(numLEDs < 1 || numLEDs > 65535 || numFrames > MAX_FRAMES) {
+    fprintf(stderr, "wfxbake: the number of LEDs must be 1 to 65535, and of frames 1 to %u\n", MAX_FRAMES);
+    return 1;
+  }
+  h.numLEDs = numLEDs;
+
+  WS2812FX ws2812fx(h.numLEDs, 0, isRGBW ? NEO_GRBW + NEO_KHZ800 : NEO_GRB + NEO_KHZ800);
+  ws2812fx.init();
+
+  char* end;
+  long mode = strtol(argv[i], &end, 10);
+  if(*end != '\0') { // look the effect up by name
+    for(mode = ws2812fx.getModeCount() - 1; mode >= 0; mode--) {
+      if(strcasecmp((const char*)ws2812fx.getModeName(mode), argv[i]) == 0) break;
+    }
+  }
+  if(mode < 0 || mode >= ws2812fx.getModeCount() || mode >= FX_MODE_CUSTOM_0) {
+    fprintf(stderr, "wfxbake: there's no %s effect\n", argv[i]);
+    return 1;
+  }
+
+  ws2812fx.setBrightness(255); // bake full brightness colors, the playing board sets the brightness
+  ws2812fx.setSegment(0, 0, h.numLEDs - 1, mode, colors, speed, options);
+  ws2812fx.start();
+
+  // run the effect, saving its frames, delays and runtimes
+  size_t frameSize = h.numLEDs * h.bytesPerPixel;
+  std::vector<uint8_t> frames;
+  std::vector<uint16_t> delays;
+  std::vector<WS2812FX::segment_runtime> states;
+  WS2812FX::segment_runtime* rt = ws2812fx.getSegmentRuntime(0);
+  uint32_t loopStart = 0;
+  bool isLooped = false;
+  while(delays.size() < (numFrames ? numFrames : MAX_FRAMES)) {
+    shimMillis++;
+    ws2812fx.service();
+    if(!ws2812fx.isFrame(0)) continue;
+
+    size_t n = frames.size();
+    frames.resize(n + frameSize);
+    for(uint16_t led=0; led < h.numLEDs; led++) {
+      uint32_t color = ws2812fx.getPixelColor(led);
+      uint8_t* p = &frames[n + led * h.bytesPerPixel];
+      p[0] = color >> 16;
+      p[1] = color >> 8;
+      p[2] = color;
+      if(isRGBW) p[3] = color >> 24;
+    }
+    uint32_t delay = ws2812fx.getNextTime(0) - shimMillis;
+    delays.push_back(delay > 65535 ? 65535 : delay);
+    shimMillis = ws2812fx.getNextTime(0);
+
+    // the effect repeats itself from an earlier frame with the same pixels and runtime on
+    if(numFrames == 0) {
+      for(uint32_t k=0; k < states.size(); k++) {
+        if(isSameState(&states[k], rt) && memcmp(&frames[k * frameSize], &frames[n], frameSize) == 0) {
+          loopStart = k;
+          isLooped = true;
+          break;
+        }
+      }
+      if(isLooped) {
+        frames.resize(n);
+        delays.pop_back();
+        break;
+      }
+      states.push_back(*rt);
+    }
+  }
+
+  // drop the frames before the effect started repeating
+  frames.erase(frames.begin(), frames.begin() + loopStart * frameSize);
+  delays.erase(delays.begin(), delays.begin() + loopStart);
+  if(numFrames == 0) {
+    if(isLooped) fprintf(stderr, "the effect repeats every %zu frames\n", delays.size());
+    else fprintf(stderr, "the effect didn't repeat within %u frames, so the clip won't loop smoothly\n", MAX_FRAMES);
+  }
+
+  std::vector<uint8_t> clip;
+  if(!clipBuild(h, frames, delays, keyInterval, clip)) return 1;
+
+  printf("// %s effect baked by wfxbake: %u LEDs, speed %u, options 0x%02x, colors 0x%06x 0x%06x 0x%06x\n",
+    (const char*)ws2812fx.getModeName(mode), h.numLEDs, speed, options, colors[0], colors[1], colors[2]);
+  printf("// %zu frames, %zu bytes. Play it with the Baked custom effect (custom/Baked.h).\n", delays.size(), clip.size());
+  printf("const uint8_t %s[] PROGMEM = {", argv[i + 2]);
+  for(size_t n=0; n < clip.size(); n++) {
+    printf("%s0x%02x%s", n % 16 ? " " : "\n  ", clip[n], n + 1 < clip.size() ? "," : "\n");
+  }
+  printf("};\n");
+  return 0;
+}
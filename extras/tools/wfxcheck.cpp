@@ -0,0 +1,318 @@
+/*
+  wfxcheck.cpp - checks WS2812FX's handling of strips longer than 65535 LEDs
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  Runs a 70000 LED strip on the host computer and checks the pixels, segments,
+  outputs, remap tables, clips and matrix effects around LED 65535, where
+  16-bit pixel indexes would wrap around.
+  Prints each check that fails, and exits with status 1 if any did.
+
+  Builds on the host computer, not the microcontroller, with the stand-in
+  Arduino and Adafruit_NeoPixel files in the shim folder:
+    g++ -O2 -DESP32 -Ishim -I../../src -o wfxcheck wfxcheck.cpp shim/Adafruit_NeoPixel.cpp "../../src/"*.cpp
+  (ESP32 is defined for 32-bit pixel indexes.) Add
+  -DWS2812FX_SIMULATE_PSRAM=65536 to run the same checks with the pixel data
+  in simulated PSRAM, and to check that the memory policies move the buffers
+  and that the outputs are sent from internal RAM.
+
+  Usage:
+    wfxcheck
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#include <stdio.h>
+#include <vector>
+#include <WS2812FX.h>
+#include <WS2812FXClip.h>
+
+#define NUM_LEDS 70000
+
+static int failures = 0;
+
+#define CHECK(test) do { if(!(test)) { failures++; printf("wfxcheck: line %d failed: %s\n", __LINE__, #test); } } while(0)
+
+// gives the checks access to the Adafruit_NeoPixel length, which syncLength() keeps within 65535 bytes
+class CheckFX : public WS2812FX {
+  public:
+    using WS2812FX::WS2812FX;
+    uint16_t baseNumLEDs(void) { return Adafruit_NeoPixel::numLEDs; }
+    uint16_t baseNumBytes(void) { return Adafruit_NeoPixel::numBytes; }
+};
+
+// the first LED's color and the length of each strip show() sends
+static int shows = 0;
+static uint32_t shownColors[MAX_NUM_OUTPUTS];
+static uint16_t shownLengths[MAX_NUM_OUTPUTS];
+
+static void onShow(const Adafruit_NeoPixel* strip) {
+  if(shows < MAX_NUM_OUTPUTS) {
+    shownColors[shows] = strip->getPixelColor(0);
+    shownLengths[shows] = strip->numPixels();
+  }
+  shows++;
+}
+
+#if defined(WS2812FX_SIMULATE_PSRAM)
+// whether any strip show() sends is in PSRAM, and the colors of each strip
+static bool isShownFromPSRAM = false;
+static int stagedShows = 0;
+static std::vector<uint32_t> stagedColors[MAX_NUM_OUTPUTS];
+
+static void onStagedShow(const Adafruit_NeoPixel* strip) {
+  if(WS2812FX::isPSRAM(strip->getPixels())) isShownFromPSRAM = true;
+  if(stagedShows < MAX_NUM_OUTPUTS) {
+    for(uint16_t n=0; n < strip->numPixels(); n++) stagedColors[stagedShows].push_back(strip->getPixelColor(n));
+  }
+  stagedShows++;
+}
+#endif
+
+// the color of every LED a custom show function sends
+static WS2812FX* shownFX = NULL;
+static uint32_t shownPixels[NUM_LEDS];
+
+static void captureShow(void) {
+  for(pixel_index_t n=0; n < NUM_LEDS; n++) shownPixels[n] = shownFX->getPixelColor(n);
+}
+
+// plays a clip from memory
+class MemoryClip : public WS2812FXClip {
+  public:
+    bool begin(const std::vector<uint8_t>* data) {
+      _data = data;
+      return open();
+    }
+
+  protected:
+    size_t readClip(uint32_t pos, uint8_t* buf, size_t len) {
+      if(pos >= _data->size()) return 0;
+      if(len > _data->size() - pos) len = _data->size() - pos;
+      memcpy(buf, _data->data() + pos, len);
+      return len;
+    }
+
+  private:
+    const std::vector<uint8_t>* _data = NULL;
+};
+
+int main(void) {
+#if PIXEL_INDEX_BITS != 32
+  fprintf(stderr, "wfxcheck: needs 32-bit pixel indexes, build it with -DESP32\n");
+  return 1;
+#else
+  const pixel_index_t last = NUM_LEDS - 1;
+  CheckFX ws2812fx(NUM_LEDS, 0, NEO_GRB + NEO_KHZ800);
+  ws2812fx.init();
+  ws2812fx.setBrightness(255);
+
+  // the strip's length, and the part of it Adafruit_NeoPixel's 16-bit fields can hold
+  CHECK(ws2812fx.getLength() == NUM_LEDS);
+  CHECK(ws2812fx.getNumBytes() == NUM_LEDS * 3);
+  CHECK(ws2812fx.getSegment(0)->stop == last);
+  CHECK(ws2812fx.baseNumLEDs() == 65535 / 3);
+  CHECK(ws2812fx.baseNumBytes() == 65535);
+#if defined(WS2812FX_SIMULATE_PSRAM)
+  CHECK(WS2812FX::isPSRAM(ws2812fx.getPixels()) == (NUM_LEDS * 3 > WS2812FX_SIMULATE_PSRAM)); // too large for internal RAM
+#endif
+
+  // pixels on both sides of LED 65535
+  const pixel_index_t leds[] = {0, 65534, 65535, 65536, last};
+  for(pixel_index_t n : leds) ws2812fx.setPixelColor(n, 0xA50000 ^ n);
+  for(pixel_index_t n : leds) CHECK(ws2812fx.getPixelColor(n) == (0xA50000 ^ n));
+  ws2812fx.setPixelColor(NUM_LEDS, RED); // past the end, ignored
+  CHECK(ws2812fx.getPixelColor(NUM_LEDS) == 0);
+  CHECK(ws2812fx.getPixelColor(0) == 0xA50000);
+
+  // fill and copyPixels across LED 65535
+  ws2812fx.fill(BLACK, 65520, 40);
+  ws2812fx.fill(GREEN, 65530, 12);
+  CHECK(ws2812fx.getPixelColor(65529) == BLACK);
+  for(pixel_index_t n=65530; n < 65542; n++) CHECK(ws2812fx.getPixelColor(n) == GREEN);
+  CHECK(ws2812fx.getPixelColor(65542) == BLACK);
+  for(pixel_index_t n=65532; n < 65538; n++) ws2812fx.setPixelColor(n, n);
+  ws2812fx.copyPixels(65538, 65532, 6);
+  for(pixel_index_t n=65532; n < 65538; n++) CHECK(ws2812fx.getPixelColor(n + 6) == n);
+
+  // a segment straddling LED 65535, and its neighbours
+  ws2812fx.setSegment(0, 0, 65529, FX_MODE_STATIC, RED, 1000, NO_OPTIONS);
+  ws2812fx.setSegment(1, 65530, 65545, FX_MODE_STATIC, BLUE, 1000, NO_OPTIONS);
+  ws2812fx.setSegment(2, 65546, last, FX_MODE_STATIC, GREEN, 1000, NO_OPTIONS);
+  ws2812fx.start();
+  shimMillis += 1000;
+  ws2812fx.service();
+  CHECK(ws2812fx.getPixelColor(65529) == RED);
+  CHECK(ws2812fx.getPixelColor(65530) == BLUE);
+  CHECK(ws2812fx.getPixelColor(65535) == BLUE);
+  CHECK(ws2812fx.getPixelColor(65545) == BLUE);
+  CHECK(ws2812fx.getPixelColor(65546) == GREEN);
+  CHECK(ws2812fx.getPixelColor(last) == GREEN);
+
+  // two 35000 LED outputs are cut to the 21845 LEDs one strip can hold, and
+  // an RGBW output (converted, not a span) covers the LEDs past 65535
+  ws2812fx.setOutput(0, 1, 0, 35000, NEO_GRB + NEO_KHZ800);
+  ws2812fx.setOutput(1, 2, 35000, 35000, NEO_GRB + NEO_KHZ800);
+  ws2812fx.setOutput(2, 3, 65540, NUM_LEDS - 65540, NEO_GRBW + NEO_KHZ800);
+  CHECK(ws2812fx.getOutput(0)->numPixels() == 21845);
+  CHECK(ws2812fx.getOutput(1)->numPixels() == 21845);
+  CHECK(ws2812fx.getOutput(1)->getNumBytes() == 65535);
+  CHECK(ws2812fx.getOutput(2)->numPixels() == NUM_LEDS - 65540);
+  ws2812fx.setSegment(0, 0, 34999, FX_MODE_STATIC, RED, 1000, NO_OPTIONS);
+  ws2812fx.setSegment(1, 35000, 65545, FX_MODE_STATIC, BLUE, 1000, NO_OPTIONS);
+  shimShowHook = onShow;
+  ws2812fx.trigger(); // run the segments now, they're not due for another second
+  ws2812fx.service();
+  shimShowHook = NULL;
+  CHECK(shows == 3);
+  CHECK(shownColors[0] == RED && shownLengths[0] == 21845);
+  CHECK(shownColors[1] == BLUE && shownLengths[1] == 21845);
+  CHECK(shownColors[2] == BLUE && shownLengths[2] == NUM_LEDS - 65540);
+  CHECK(ws2812fx.getOutput(2)->getPixelColor(5) == BLUE);
+  CHECK(ws2812fx.getOutput(2)->getPixelColor(6) == GREEN);
+  CHECK(ws2812fx.getOutput(2)->getPixelColor(NUM_LEDS - 65540 - 1) == GREEN);
+
+  // a run-length encoded remap table across LED 65535. Each pixel's color is
+  // its own index, so the LEDs show which pixel they were mapped to
+  WS2812FX::remap_run runs[] = {
+    {0, 65530, NO_OPTIONS},
+    {65530, 20, REVERSE},            // LEDs 65530-65549 show pixels 65549-65530
+    {REMAP_RUN_NONE, 10, NO_OPTIONS}, // LEDs 65550-65559 are off
+    {65535, 100, NO_OPTIONS},        // LEDs 65560-65659 show pixels 65535-65634
+    {69990, 20, REVERSE}             // LEDs 65660-65669 are past the end of the strip, 65670-65679 show pixels 69999-69990
+  };
+  ws2812fx.setRemap(runs, 5);
+  ws2812fx.service(); // the segments are redrawn when the output stage starts
+  shownFX = &ws2812fx;
+  ws2812fx.setCustomShow(captureShow);
+  for(pixel_index_t n=0; n < NUM_LEDS; n++) ws2812fx.setPixelColor(n, n);
+  ws2812fx.setRemap(runs, 5); // setting the table again shows the pixels, the segments aren't due
+  shimMillis += OUTPUT_INTERVAL;
+  ws2812fx.service();
+  int remapped = 0;
+  for(pixel_index_t n=0; n < NUM_LEDS; n++) {
+    pixel_index_t expected = n;
+    if(n >= 65530 && n < 65550) expected = 65549 - (n - 65530);
+    else if(n >= 65550 && n < 65560) expected = 0;
+    else if(n >= 65560 && n < 65660) expected = 65535 + (n - 65560);
+    else if(n >= 65660 && n < 65670) expected = 0;
+    else if(n >= 65670 && n < 65680) expected = 69999 - (n - 65670);
+    if(shownPixels[n] == expected) remapped++;
+  }
+  CHECK(remapped == NUM_LEDS);
+  CHECK(shownPixels[65559] == 0 && shownPixels[65560] == 65535 && shownPixels[65680] == 65680);
+  ws2812fx.removeRemap();
+  ws2812fx.setCustomShow(NULL);
+
+  // a 65535 LED clip on a segment straddling LED 65535. The clip's first 10
+  // LEDs are orange, and the first frame then skips to its last LEDs with
+  // ops that run past them, which a 16-bit decoder would wrap around to its
+  // first LEDs
+  std::vector<uint8_t> clipData(CLIP_HEADER_SIZE + CLIP_FRAME_HEADER_SIZE);
+  clip_header header = {0, 3, 65535, 1, 0};
+  clipWriteHeader(clipData.data(), &header);
+  clipData.insert(clipData.end(), {CLIP_OP_REPEAT | 9, 0xFF, 0x30, 0x00}); // pixels 0-9
+  for(int k=0; k < 1023; k++) clipData.push_back(CLIP_OP_SKIP | 63);     // pixels 10-65481
+  clipData.push_back(CLIP_OP_LITERAL | 63);                               // pixels 65482-65545
+  for(int k=0; k < 64; k++) clipData.insert(clipData.end(), {0x40, 0x00, 0x80});
+  clip_frame frame = {CLIP_KEYFRAME, 1000, (uint32_t)(clipData.size() - CLIP_HEADER_SIZE - CLIP_FRAME_HEADER_SIZE)};
+  clipWriteFrame(clipData.data() + CLIP_HEADER_SIZE, &frame);
+  MemoryClip clip;
+  CHECK(clip.begin(&clipData));
+  ws2812fx.setSegment(1, 65530, 65545, FX_MODE_CLIP, BLUE, 1000, NO_OPTIONS);
+  ws2812fx.setExtDataSrc(1, (uint8_t*)&clip, 1);
+  ws2812fx.trigger();
+  ws2812fx.service();
+  for(pixel_index_t n=65530; n < 65540; n++) CHECK(ws2812fx.getPixelColor(n) == ORANGE);
+  CHECK(ws2812fx.getPixelColor(65540) == 65540); // past the segment's first 10 LEDs the clip only has pixels it can't reach
+  CHECK(ws2812fx.getPixelColor(65546) == GREEN);
+
+  // matrix effects treat a segment without a matrix layout as one row of at
+  // most 65535 LEDs, and leave the rest alone
+  ws2812fx.removeActiveSegment(1);
+  ws2812fx.removeActiveSegment(2);
+  ws2812fx.setSegment(0, 0, last, FX_MODE_MATRIX_SCROLL, RED, 1000, NO_OPTIONS);
+  for(pixel_index_t n=0; n < NUM_LEDS; n++) ws2812fx.setPixelColor(n, GRAY);
+  ws2812fx.trigger();
+  ws2812fx.service();
+  CHECK(ws2812fx.getPixelColor(65534) == ws2812fx.color_wheel(0)); // the scrolling column enters at the end of the row
+  CHECK(ws2812fx.getPixelColor(65533) == GRAY);
+  CHECK(ws2812fx.getPixelColor(65535) == GRAY);
+  CHECK(ws2812fx.getPixelColor(last) == GRAY);
+
+#if defined(WS2812FX_SIMULATE_PSRAM)
+  // the memory policy puts the pixel data and the output stage in PSRAM, and
+  // the outputs are sent to the LEDs from a staging buffer in internal RAM
+  ws2812fx.setMemoryPolicy(PSRAM_PIXELS | PSRAM_BUFFERS);
+  CHECK(WS2812FX::isPSRAM(ws2812fx.getPixels()));
+  ws2812fx.setSegment(0, 0, last, FX_MODE_STATIC, RED, 1000, NO_OPTIONS);
+  ws2812fx.trigger();
+  ws2812fx.service();
+  for(pixel_index_t n=0; n < NUM_LEDS; n++) ws2812fx.setPixelColor(n, n);
+  ws2812fx.setSegmentBrightness(0, 255); // shows the pixels, the segment isn't due
+  shimMillis += OUTPUT_INTERVAL;
+  shimShowHook = onStagedShow;
+  ws2812fx.service();
+  shimShowHook = NULL;
+  CHECK(stagedShows == 3);
+  CHECK(!isShownFromPSRAM);
+  const pixel_index_t firsts[] = {0, 35000, 65540};
+  for(uint8_t i=0; i < 3; i++) {
+    int staged = 0;
+    for(uint32_t n=0; n < stagedColors[i].size(); n++) {
+      if(stagedColors[i][n] == ws2812fx.getPixelColor(firsts[i] + n)) staged++;
+    }
+    CHECK(stagedColors[i].size() == ws2812fx.getOutput(i)->numPixels() && staged == (int)stagedColors[i].size());
+  }
+
+  // PSRAM_NONE leaves a buffer that doesn't fit in internal RAM in PSRAM
+  ws2812fx.setMemoryPolicy(PSRAM_NONE);
+  CHECK(WS2812FX::isPSRAM(ws2812fx.getPixels()) == (NUM_LEDS * 3 > WS2812FX_SIMULATE_PSRAM));
+#endif
+
+  // changing the length keeps the Adafruit_NeoPixel length in step
+  ws2812fx.setLength(100000);
+  CHECK(ws2812fx.getLength() == 100000);
+  CHECK(ws2812fx.baseNumLEDs() == 65535 / 3);
+  ws2812fx.setLength(1000);
+  CHECK(ws2812fx.getLength() == 1000);
+  CHECK(ws2812fx.baseNumLEDs() == 1000 && ws2812fx.baseNumBytes() == 3000);
+
+#if defined(WS2812FX_SIMULATE_PSRAM)
+  // the shorter strip's pixel data moves to PSRAM and back with the memory policy
+  CHECK(!WS2812FX::isPSRAM(ws2812fx.getPixels()));
+  ws2812fx.setMemoryPolicy(PSRAM_PIXELS | PSRAM_BUFFERS);
+  CHECK(WS2812FX::isPSRAM(ws2812fx.getPixels()));
+  ws2812fx.setMemoryPolicy(PSRAM_NONE);
+  CHECK(!WS2812FX::isPSRAM(ws2812fx.getPixels()));
+#endif
+
+  if(failures == 0) printf("wfxcheck: all checks passed\n");
+  return failures == 0 ? 0 : 1;
+#endif
+}
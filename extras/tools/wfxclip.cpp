@@ -0,0 +1,223 @@
+/*
+  wfxclip.cpp - encodes and decodes WS2812FX animation clips
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  Builds on the host computer, not the microcontroller:
+    g++ -O2 -o wfxclip wfxclip.cpp
+
+  Usage:
+    wfxclip encode [options] <LEDs> <frames file> <clip file>
+      -w         frames are RGBW, instead of RGB
+      -p         store the colors in a palette (256 colors max)
+      -d <ms>    delay for every frame (default 0, use the segment's speed)
+      -t <file>  text file of delays, one per frame (overrides -d)
+      -k <n>     make every nth frame a keyframe (default 0, only the first)
+    wfxclip decode <clip file> <frames file> [delays file]
+
+  A frames file is the raw R, G, B[, W] bytes of each LED of each frame, one
+  frame after the other. Decoding a clip writes the exact frames and delays
+  it was encoded from.
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "clip_writer.h"
+
+static int usage(void) {
+  fprintf(stderr, "usage: wfxclip encode [-w] [-p] [-d ms] [-t delays] [-k n] <LEDs> <frames> <clip>\n");
+  fprintf(stderr, "       wfxclip decode <clip> <frames> [delays]\n");
+  return 2;
+}
+
+static bool readFile(const char* name, std::vector<uint8_t>& data) {
+  FILE* f = fopen(name, "rb");
+  if(f == NULL) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+static bool writeFile(const char* name, const std::vector<uint8_t>& data) {
+  FILE* f = fopen(name, "wb");
+  if(f == NULL) return false;
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  return fclose(f) == 0 && ok;
+}
+
+static int encode(int argc, char** argv) {
+  clip_header h = {};
+  h.bytesPerPixel = 3;
+  uint16_t delay = 0;
+  uint32_t keyInterval = 0;
+  const char* delaysName = NULL;
+  int i = 0;
+  for(; i < argc && argv[i][0] == '-'; i++) {
+    char opt = argv[i][1];
+    if(opt == 'w') h.bytesPerPixel = 4;
+    else if(opt == 'p') h.flags |= CLIP_PALETTE;
+    else if(i + 1 < argc && opt == 'd') delay = atoi(argv[++i]);
+    else if(i + 1 < argc && opt == 't') delaysName = argv[++i];
+    else if(i + 1 < argc && opt == 'k') keyInterval = atoi(argv[++i]);
+    else return usage();
+  }
+  if(argc - i != 3) return usage();
+  long numLEDs = atol(argv[i]);
+  if(numLEDs < 1 || numLEDs > 65535) {
+    fprintf(stderr, "wfxclip: the number of LEDs must be 1 to 65535\n");
+    return 1;
+  }
+  h.numLEDs = numLEDs;
+
+  std::vector<uint8_t> frames;
+  if(!readFile(argv[i + 1], frames)) {
+    fprintf(stderr, "wfxclip: can't read %s\n", argv[i + 1]);
+    return 1;
+  }
+  size_t frameSize = h.numLEDs * h.bytesPerPixel;
+  if(frames.empty() || frames.size() % frameSize != 0) {
+    fprintf(stderr, "wfxclip: %s isn't a whole number of %u LED frames\n", argv[i + 1], h.numLEDs);
+    return 1;
+  }
+  h.numFrames = frames.size() / frameSize;
+
+  std::vector<uint16_t> delays(h.numFrames, delay);
+  if(delaysName != NULL) {
+    FILE* f = fopen(delaysName, "r");
+    if(f == NULL) {
+      fprintf(stderr, "wfxclip: can't read %s\n", delaysName);
+      return 1;
+    }
+    for(uint32_t n=0; n < h.numFrames; n++) {
+      unsigned int ms;
+      if(fscanf(f, "%u", &ms) != 1 || ms > 65535) {
+        fprintf(stderr, "wfxclip: %s needs a delay (0 to 65535) for each of the %u frames\n", delaysName, h.numFrames);
+        fclose(f);
+        return 1;
+      }
+      delays[n] = ms;
+    }
+    fclose(f);
+  }
+
+  std::vector<uint8_t> clip;
+  if(!clipBuild(h, frames, delays, keyInterval, clip)) return 1;
+  if(!writeFile(argv[i + 2], clip)) {
+    fprintf(stderr, "wfxclip: can't write %s\n", argv[i + 2]);
+    return 1;
+  }
+  return 0;
+}
+
+struct frame_buffer {
+  uint8_t* pixels;
+  uint8_t bytesPerPixel;
+};
+
+static void putPixel(void* ctx, uint32_t n, uint32_t color) {
+  frame_buffer* fb = (frame_buffer*)ctx;
+  uint8_t* p = fb->pixels + n * fb->bytesPerPixel;
+  p[0] = color >> 16;
+  p[1] = color >> 8;
+  p[2] = color;
+  if(fb->bytesPerPixel == 4) p[3] = color >> 24;
+}
+
+static int decode(int argc, char** argv) {
+  if(argc < 2 || argc > 3) return usage();
+
+  std::vector<uint8_t> clip;
+  if(!readFile(argv[0], clip)) {
+    fprintf(stderr, "wfxclip: can't read %s\n", argv[0]);
+    return 1;
+  }
+  clip_header h;
+  if(clip.size() < CLIP_HEADER_SIZE || !clipReadHeader(clip.data(), &h)) {
+    fprintf(stderr, "wfxclip: %s isn't a clip\n", argv[0]);
+    return 1;
+  }
+  size_t pos = CLIP_HEADER_SIZE;
+  const uint8_t* palette = NULL;
+  if(h.flags & CLIP_PALETTE) {
+    palette = &clip[pos];
+    pos += h.paletteSize * h.bytesPerPixel;
+  }
+
+  size_t frameSize = h.numLEDs * h.bytesPerPixel;
+  std::vector<uint8_t> frames((size_t)h.numFrames * frameSize);
+  std::vector<uint16_t> delays;
+  frame_buffer fb = { frames.data(), h.bytesPerPixel };
+  clip_decoder d;
+  clipBeginDecode(&d, &h, palette, putPixel, &fb);
+  for(uint32_t n=0; n < h.numFrames; n++) {
+    clip_frame f;
+    if(pos + CLIP_FRAME_HEADER_SIZE > clip.size()) break;
+    clipReadFrame(&clip[pos], &f);
+    pos += CLIP_FRAME_HEADER_SIZE;
+    if(pos + f.size > clip.size() || (n == 0 && f.type != CLIP_KEYFRAME)) break;
+
+    // a frame starts as a copy of the previous frame
+    fb.pixels = &frames[n * frameSize];
+    if(n > 0) memcpy(fb.pixels, fb.pixels - frameSize, frameSize);
+    clipBeginFrame(&d);
+    clipDecode(&d, &clip[pos], f.size);
+    pos += f.size;
+    delays.push_back(f.delay);
+  }
+  if(delays.size() != h.numFrames || pos != clip.size()) {
+    fprintf(stderr, "wfxclip: %s is damaged\n", argv[0]);
+    return 1;
+  }
+
+  if(!writeFile(argv[1], frames)) {
+    fprintf(stderr, "wfxclip: can't write %s\n", argv[1]);
+    return 1;
+  }
+  if(argc == 3) {
+    FILE* f = fopen(argv[2], "w");
+    if(f == NULL) {
+      fprintf(stderr, "wfxclip: can't write %s\n", argv[2]);
+      return 1;
+    }
+    for(size_t n=0; n < delays.size(); n++) fprintf(f, "%u\n", delays[n]);
+    fclose(f);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if(argc < 2) return usage();
+  if(strcmp(argv[1], "encode") == 0) return encode(argc - 2, argv + 2);
+  if(strcmp(argv[1], "decode") == 0) return decode(argc - 2, argv + 2);
+  return usage();
+}
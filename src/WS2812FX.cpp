@@ -69,21 +69,88 @@ bool WS2812FX::service() {
   bool doShow = false;
   if(_running || _triggered) {
     unsigned long now = millis(); // Be aware, millis() rolls over every 49 days
-    for(uint8_t i=0; i < _active_segments_len; i++) {
+#if !defined(MEGATINYCORE)
+    if(_cues != NULL) (this->*_service_cues)(now);
+
+    // only the segments that ran last time have frame and cycle flags to clear
+    uint16_t numWords = (_active_segments_len + 31) / 32;
+    for(uint16_t w=0; w < numWords; w++) {
+      for(uint32_t bits = _ran_bits[w]; bits != 0; bits &= bits - 1) {
+        _segment_runtimes[w * 32 + __builtin_ctzl(bits)].aux_param2 &= ~(FRAME | CYCLE);
+      }
+      _ran_bits[w] = 0;
+    }
+    bool isChained = false;
+
+    // visit the active slots in order, skipping the empty ones 32 at a time.
+    // Only the next_time array is read for segments that aren't due.
+    for(uint16_t w=0; w < numWords; w++) {
+      for(uint32_t bits = _active_bits[w]; bits != 0; bits &= bits - 1) {
+        segment_id_t i = w * 32 + __builtin_ctzl(bits);
+        if(now > _next_times[i] || _triggered) {
+          if(_twins != NULL) {
+            if(!isChained) (this->*_chain_twins)(now, i); // only once a segment is due, none of the slots before it are
+            isChained = true;
+            if(_twins[i] != INACTIVE_SEGMENT) continue; // already copied from an identical segment
+          }
+          _ran_bits[w] |= bits & (0 - bits);
+          _seg     = &_segments[_active_segments[i]];
+          _seg_len = (pixel_index_t)(_seg->stop - _seg->start + 1);
+          _seg_rt  = &_segment_runtimes[i];
+          _seg_matrix = _matrices != NULL ? &_matrices[_active_segments[i]] : NULL;
+          _seg_origin = _seg->start;
+          _seg_scale = segmentScale(_active_segments[i]);
+#else
+    for(segment_id_t i=0; i < _active_segments_len; i++) {
       if(_active_segments[i] != INACTIVE_SEGMENT) {
         _seg     = &_segments[_active_segments[i]];
-        _seg_len = (uint16_t)(_seg->stop - _seg->start + 1);
+        _seg_len = (pixel_index_t)(_seg->stop - _seg->start + 1);
         _seg_rt  = &_segment_runtimes[i];
         CLR_FRAME_CYCLE;
         if(now > _seg_rt->next_time || _triggered) {
+#endif
           SET_FRAME;
           doShow = true;
+#if !defined(MEGATINYCORE)
+          segment_runtime before;
+          unsigned long beforeTime = _next_times[i];
+          if(_twins != NULL) before = *_seg_rt;
+          uint16_t keyInterval = _keyframes != NULL ? _keyframes[_active_segments[i]].interval : 0;
+          if(keyInterval) (this->*_capture_keyframe)(_active_segments[i]);
+          bool isCacheOn = _caches != NULL && _caches[_active_segments[i]].budget;
+          uint16_t delay = isCacheOn ? (this->*_run_cached)(_active_segments[i]) : runMode();
+          if(keyInterval) {
+            // run the effect's steps for the whole keyframe interval, so effects
+            // that move one step per call keep their speed
+            uint32_t elapsed = delay > SPEED_MIN ? delay : SPEED_MIN;
+            while(elapsed < keyInterval) {
+              _seg_rt->counter_mode_call++;
+              uint16_t step = isCacheOn ? (this->*_run_cached)(_active_segments[i]) : runMode();
+              elapsed += step > SPEED_MIN ? step : SPEED_MIN;
+            }
+            delay = elapsed < 65535 ? elapsed : 65535;
+          }
+#else
           uint16_t delay = (MODE_PTR(_seg->mode))();
+#endif
+#if !defined(MEGATINYCORE)
+          _next_times[i] = now + (delay > SPEED_MIN ? delay : SPEED_MIN);
+          _seg_rt->counter_mode_call++;
+          if(_twins != NULL) (this->*_dedupe_segment)(i, &before, beforeTime);
+#else
           _seg_rt->next_time = now + (delay > SPEED_MIN ? delay : SPEED_MIN);
           _seg_rt->counter_mode_call++;
+#endif
         }
       }
     }
+#if !defined(MEGATINYCORE)
+    if(_layers != NULL && (this->*_service_layers)(now)) doShow = true;
+    if(_transitions != NULL && (this->*_service_transitions)(now)) doShow = true;
+
+    // keep the LEDs updated while the output stage is changing brightness
+    if(_output_pending && (now - _show_time) >= OUTPUT_INTERVAL) doShow = true;
+#endif
     if(doShow) {
       delay(1); // for ESP32 (see https://forums.adafruit.com/viewtopic.php?f=47&t=117327)
       execShow();
@@ -93,9 +160,45 @@ bool WS2812FX::service() {
   return doShow;
 }
 
+#if !defined(MEGATINYCORE)
+/*
+ * Run a segment's mode, rendering into a separate pixel buffer instead of the
+ * strip's pixel data. The segment is rendered as if it were a strip of len
+ * LEDs starting at LED 0, so the buffer only needs to be the size of the segment.
+ * Returns the mode's delay, like calling the mode directly.
+ */
+uint16_t WS2812FX::renderShadow(segment* seg, segment_runtime* rt, uint8_t* buf, pixel_index_t len) {
+  segment* prevSeg = _seg;
+  segment_runtime* prevSegRt = _seg_rt;
+  pixel_index_t prevSegLen = _seg_len;
+  uint8_t* prevPixels = pixels;
+  pixel_index_t prevNumLEDs = numLEDs;
+  pixel_index_t prevNumBytes = numBytes;
+
+  seg->start = 0;
+  seg->stop = len - 1;
+  _seg = seg;
+  _seg_rt = rt;
+  _seg_len = len;
+  pixels = buf;
+  numLEDs = len;
+  numBytes = len * getNumBytesPerPixel();
+
+  uint16_t delay = runMode();
+
+  _seg = prevSeg;
+  _seg_rt = prevSegRt;
+  _seg_len = prevSegLen;
+  pixels = prevPixels;
+  numLEDs = prevNumLEDs;
+  numBytes = prevNumBytes;
+  return delay;
+}
+#endif
+
 // overload setPixelColor() functions so we can use gamma correction
 // (see https://learn.adafruit.com/led-tricks-gamma-correction/the-issue)
-void WS2812FX::setPixelColor(uint16_t n, uint32_t c) {
+void WS2812FX::setPixelColor(pixel_index_t n, uint32_t c) {
   uint8_t w = (c >> 24) & 0xFF;
   uint8_t r = (c >> 16) & 0xFF;
   uint8_t g = (c >>  8) & 0xFF;
@@ -103,15 +206,33 @@ void WS2812FX::setPixelColor(uint16_t n, uint32_t c) {
   setPixelColor(n, r, g, b, w);
 }
 
-void WS2812FX::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+void WS2812FX::setPixelColor(pixel_index_t n, uint8_t r, uint8_t g, uint8_t b) {
   setPixelColor(n, r, g, b, 0);
 }
 
-void WS2812FX::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+void WS2812FX::setPixelColor(pixel_index_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
 #if defined(MEGATINYCORE)  // if compiling for an ATtiny device (to conserve memory, no gamma correction)
   tinyNeoPixel::setPixelColor(n, r, g, b, w);
+#elif PIXEL_INDEX_BITS == 32 // Adafruit_NeoPixel::setPixelColor() can't reach past LED 65535
+  if(n >= numLEDs) return;
+  if(IS_GAMMA && _out_pixels == NULL) { // the output stage does its own gamma correction
+    r = gamma8(r); g = gamma8(g); b = gamma8(b); w = gamma8(w);
+  }
+  if(brightness) { // Adafruit_NeoPixel internally offsets brightness by 1, zero is full brightness
+    r = (r * brightness) >> 8; g = (g * brightness) >> 8; b = (b * brightness) >> 8; w = (w * brightness) >> 8;
+  }
+  uint8_t *p;
+  if(wOffset == rOffset) {
+    p = &pixels[n * 3];
+  } else {
+    p = &pixels[n * 4];
+    p[wOffset] = w;
+  }
+  p[rOffset] = r;
+  p[gOffset] = g;
+  p[bOffset] = b;
 #else
-  if(IS_GAMMA) {
+  if(IS_GAMMA && _out_pixels == NULL) { // the output stage does its own gamma correction
     Adafruit_NeoPixel::setPixelColor(n, gamma8(r), gamma8(g), gamma8(b), gamma8(w));
   } else {
     Adafruit_NeoPixel::setPixelColor(n, r, g, b, w);
@@ -120,7 +241,7 @@ void WS2812FX::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_
 }
 
 // custom setPixelColor() function that bypasses the Adafruit_Neopixel global brightness rigmarole
-void WS2812FX::setRawPixelColor(uint16_t n, uint32_t c) {
+void WS2812FX::setRawPixelColor(pixel_index_t n, uint32_t c) {
   if (n < numLEDs) {
     uint8_t *p = (wOffset == rOffset) ? &pixels[n * 3] : &pixels[n * 4];
     uint8_t w = (uint8_t)(c >> 24), r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c;
@@ -133,7 +254,7 @@ void WS2812FX::setRawPixelColor(uint16_t n, uint32_t c) {
 }
 
 // custom getPixelColor() function that bypasses the Adafruit_Neopixel global brightness rigmarole
-uint32_t WS2812FX::getRawPixelColor(uint16_t n) {
+uint32_t WS2812FX::getRawPixelColor(pixel_index_t n) {
   if (n >= numLEDs) return 0; // Out of bounds, return no color.
 
   if(wOffset == rOffset) { // RGB
@@ -145,29 +266,119 @@ uint32_t WS2812FX::getRawPixelColor(uint16_t n) {
   }
 }
 
-void WS2812FX::copyPixels(uint16_t dest, uint16_t src, uint16_t count) {
+void WS2812FX::copyPixels(pixel_index_t dest, pixel_index_t src, pixel_index_t count) {
   uint8_t *pixels = getPixels();
   uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
 
   memmove(pixels + (dest * bytesPerPixel), pixels + (src * bytesPerPixel), count * bytesPerPixel);
 }
 
+/*
+ * Scroll the current segment by one pixel (towards the segment's end, or
+ * towards its start if the segment is reversed), and set the pixel that
+ * scrolls in to color c. Once the output stage is in use, the segment's pixel
+ * data is treated as a ring buffer. Instead of moving every pixel, the ring's
+ * head moves one pixel, and the output stage rotates the pixel data back into
+ * place. Effects that scroll this way shouldn't read back the segment's pixels.
+ */
+void WS2812FX::shiftPixels(uint32_t c) {
+#if !defined(MEGATINYCORE)
+  if(_out_pixels != NULL && !IS_MIRROR) {
+    pixel_index_t head = _seg_rt->head < _seg_len ? _seg_rt->head : 0;
+    if(IS_REVERSE) {
+      setPixelColor(_seg->start + head, c);
+      _seg_rt->head = head + 1 < _seg_len ? head + 1 : 0;
+    } else {
+      _seg_rt->head = head > 0 ? head - 1 : _seg_len - 1;
+      setPixelColor(_seg->start + _seg_rt->head, c);
+    }
+    return;
+  }
+  _seg_rt->head = 0;
+#endif
+  if(IS_REVERSE) {
+    copyPixels(_seg->start, _seg->start + 1, _seg_len - 1);
+    setPixelColor(_seg->stop, c);
+  } else {
+    copyPixels(_seg->start + 1, _seg->start, _seg_len - 1);
+    setPixelColor(_seg->start, c);
+  }
+}
+
 // change the underlying Adafruit_NeoPixel pixels pointer (use with care)
-void WS2812FX::setPixels(uint16_t num_leds, uint8_t* ptr) {
+void WS2812FX::setPixels(pixel_index_t num_leds, uint8_t* ptr) {
   free(pixels); // free existing data (if any)
   pixels = ptr;
   numLEDs = num_leds;
   numBytes = num_leds * ((wOffset == rOffset) ? 3 : 4);
+#if PIXEL_INDEX_BITS == 32
+  syncLength();
+#endif
+}
+
+#if PIXEL_INDEX_BITS == 32
+// Adafruit_NeoPixel::updateLength() for strips of more than 65535 LEDs
+void WS2812FX::updateLength(pixel_index_t n) {
+  free(pixels); // free existing data (if any)
+  numBytes = n * ((wOffset == rOffset) ? 3 : 4);
+  pixels = allocBuffer(numBytes, PSRAM_PIXELS);
+  if(pixels != NULL) {
+    memset(pixels, 0, numBytes);
+    numLEDs = n;
+  } else {
+    numLEDs = numBytes = 0;
+  }
+  syncLength();
+}
+
+/*
+ * Update Adafruit_NeoPixel's 16-bit LED count and pixel data size to match
+ * the strip. Strips with more than 65535 bytes of pixel data are too long for
+ * Adafruit_NeoPixel::show(), which sends as many LEDs as fit in 65535 bytes.
+ * Longer strips are sent to the LEDs with setOutput() or setCustomShow().
+ */
+void WS2812FX::syncLength(void) {
+  uint8_t bytesPerPixel = getNumBytesPerPixel();
+  pixel_index_t n = numLEDs < 65535 / bytesPerPixel ? numLEDs : 65535 / bytesPerPixel;
+  Adafruit_NeoPixel::numLEDs = n;
+  Adafruit_NeoPixel::numBytes = n * bytesPerPixel;
 }
+#endif
 
 // run the default or custom show() function
 void WS2812FX::execShow(void) {
+#if !defined(MEGATINYCORE)
+  _show_time = millis();
+  _output_pending = false;
+
+  // if the output stage is in use, temporarily swap in the output buffer,
+  // so show() (or a custom show function) sends it to the LEDs
+  uint8_t* renderPixels = pixels;
+  if(_out_pixels != NULL && (this->*_encode_output)()) pixels = _out_pixels;
+
+  // DMA drivers can't read PSRAM, so pixel data in PSRAM is sent from a copy in internal RAM
+  if(customShow != NULL) {
+    stagePixels(numBytes);
+    customShow();
+  } else if(_outputs != NULL) {
+    (this->*_show_outputs)();
+  } else {
+    stagePixels(Adafruit_NeoPixel::numBytes);
+    show();
+  }
+  pixels = renderPixels;
+#else
   customShow == NULL ? show() : customShow();
+#endif
 }
 
 void WS2812FX::start() {
   resetSegmentRuntimes();
   _running = true;
+#if !defined(MEGATINYCORE)
+  _power_on_time = millis();
+  _output_pending = _power_on_ramp != 0;
+#endif
 }
 
 void WS2812FX::stop() {
@@ -191,12 +402,18 @@ void WS2812FX::setMode(uint8_t m) {
   setMode(0, m);
 }
 
-void WS2812FX::setMode(uint8_t seg, uint8_t m) {
+void WS2812FX::setMode(segment_id_t seg, uint8_t m) {
+#if !defined(MEGATINYCORE)
+  if(_segments[seg].mode != m && _auto_transition != NULL) (this->*_auto_transition)(seg);
+#endif
   resetSegmentRuntime(seg);
   _segments[seg].mode = constrain(m, 0, MODE_COUNT - 1);
 }
 
-void WS2812FX::setOptions(uint8_t seg, uint8_t o) {
+void WS2812FX::setOptions(segment_id_t seg, uint8_t o) {
+#if !defined(MEGATINYCORE)
+  if(_segments[seg].options != o && _auto_transition != NULL) (this->*_auto_transition)(seg);
+#endif
   _segments[seg].options = o;
 }
 
@@ -204,7 +421,16 @@ void WS2812FX::setSpeed(uint16_t s) {
   setSpeed(0, s);
 }
 
-void WS2812FX::setSpeed(uint8_t seg, uint16_t s) {
+void WS2812FX::setSpeed(segment_id_t seg, uint16_t s) {
+#if !defined(MEGATINYCORE)
+  // if automatic transitions are enabled, ramp to the new speed instead of jumping to it
+  if(_running && _transitions != NULL && _transitions[seg].auto_duration) {
+    _transitions[seg].from_speed = _segments[seg].speed;
+    _transitions[seg].to_speed = constrain(s, SPEED_MIN, SPEED_MAX);
+    _transitions[seg].speed_time = millis();
+    return;
+  }
+#endif
   _segments[seg].speed = constrain(s, SPEED_MIN, SPEED_MAX);
 }
 
@@ -230,11 +456,17 @@ void WS2812FX::setColor(uint32_t c) {
   setColor(0, c);
 }
 
-void WS2812FX::setColor(uint8_t seg, uint32_t c) {
+void WS2812FX::setColor(segment_id_t seg, uint32_t c) {
+#if !defined(MEGATINYCORE)
+  if(_segments[seg].colors[0] != c && _auto_transition != NULL) (this->*_auto_transition)(seg);
+#endif
   _segments[seg].colors[0] = c;
 }
 
-void WS2812FX::setColors(uint8_t seg, uint32_t* c) {
+void WS2812FX::setColors(segment_id_t seg, uint32_t* c) {
+#if !defined(MEGATINYCORE)
+  if(_auto_transition != NULL && memcmp(_segments[seg].colors, c, sizeof(_segments[seg].colors)) != 0) (this->*_auto_transition)(seg);
+#endif
   for(uint8_t i=0; i<MAX_NUM_COLORS; i++) {
     _segments[seg].colors[i] = c[i];
   }
@@ -242,8 +474,27 @@ void WS2812FX::setColors(uint8_t seg, uint32_t* c) {
 
 void WS2812FX::setBrightness(uint8_t b) {
 //b = constrain(b, BRIGHTNESS_MIN, BRIGHTNESS_MAX);
-  brightness = b;
+#if defined(MEGATINYCORE)
+  brightness = b + 1; // tinyNeoPixel internally offsets brightness by 1
   execShow();
+#else
+  if(_out_pixels != NULL) { // the output stage applies the brightness, ramping from the current level
+    _start_brightness = _brightness;
+    _target_brightness = b;
+    _brightness_time = millis();
+    if(_brightness_ramp == 0) _brightness = b;
+  } else {
+    brightness = b + 1; // Adafruit_NeoPixel internally offsets brightness by 1
+  }
+
+  // while running, leave it to service() to show the change with the next frame,
+  // so a burst of brightness changes doesn't cause a burst of shows
+  if(_running) {
+    _output_pending = true;
+  } else {
+    execShow();
+  }
+#endif
 }
 
 void WS2812FX::increaseBrightness(uint8_t s) {
@@ -256,7 +507,7 @@ void WS2812FX::decreaseBrightness(uint8_t s) {
   setBrightness(getBrightness() - s);
 }
 
-void WS2812FX::setLength(uint16_t b) {
+void WS2812FX::setLength(pixel_index_t b) {
   resetSegmentRuntimes();
   if (b < 1) b = 1;
 
@@ -265,18 +516,21 @@ void WS2812FX::setLength(uint16_t b) {
       updateLength(b);
       b--;
   } while(!(numLEDs && b > 1));
+#if PIXEL_INDEX_BITS == 16 && !defined(MEGATINYCORE)
+  placeBuffers(); // Adafruit_NeoPixel allocates the pixel data with malloc()
+#endif
 
   _segments[0].start = 0;
   _segments[0].stop = numLEDs - 1;
 }
 
-void WS2812FX::increaseLength(uint16_t s) {
-  uint16_t seglen = _segments[0].stop - _segments[0].start + 1;
+void WS2812FX::increaseLength(pixel_index_t s) {
+  pixel_index_t seglen = _segments[0].stop - _segments[0].start + 1;
   setLength(seglen + s);
 }
 
-void WS2812FX::decreaseLength(uint16_t s) {
-  uint16_t seglen = _segments[0].stop - _segments[0].start + 1;
+void WS2812FX::decreaseLength(pixel_index_t s) {
+  pixel_index_t seglen = _segments[0].stop - _segments[0].start + 1;
   fill(BLACK, _segments[0].start, seglen);
   execShow();
 
@@ -295,20 +549,20 @@ bool WS2812FX::isFrame(void) {
   return isFrame(0);
 }
 
-bool WS2812FX::isFrame(uint8_t seg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr == NULL) return false; // segment not active
-  return (_segment_runtimes[ptr - _active_segments].aux_param2 & FRAME);
+bool WS2812FX::isFrame(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot == INACTIVE_SEGMENT) return false; // segment not active
+  return (_segment_runtimes[slot].aux_param2 & FRAME);
 }
 
 bool WS2812FX::isCycle() {
   return isCycle(0);
 }
 
-bool WS2812FX::isCycle(uint8_t seg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr == NULL) return false; // segment not active
-  return (_segment_runtimes[ptr - _active_segments].aux_param2 & CYCLE);
+bool WS2812FX::isCycle(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot == INACTIVE_SEGMENT) return false; // segment not active
+  return (_segment_runtimes[slot].aux_param2 & CYCLE);
 }
 
 void WS2812FX::setCycle() {
@@ -319,7 +573,7 @@ uint8_t WS2812FX::getMode(void) {
   return getMode(0);
 }
 
-uint8_t WS2812FX::getMode(uint8_t seg) {
+uint8_t WS2812FX::getMode(segment_id_t seg) {
   return _segments[seg].mode;
 }
 
@@ -327,19 +581,19 @@ uint16_t WS2812FX::getSpeed(void) {
   return getSpeed(0);
 }
 
-uint16_t WS2812FX::getSpeed(uint8_t seg) {
+uint16_t WS2812FX::getSpeed(segment_id_t seg) {
   return _segments[seg].speed;
 }
 
-uint8_t WS2812FX::getOptions(uint8_t seg) {
+uint8_t WS2812FX::getOptions(segment_id_t seg) {
   return _segments[seg].options;
 }
 
-uint16_t WS2812FX::getLength(void) {
+pixel_index_t WS2812FX::getLength(void) {
   return numPixels();
 }
 
-uint16_t WS2812FX::getNumBytes(void) {
+pixel_index_t WS2812FX::getNumBytes(void) {
   return numBytes;
 }
 
@@ -351,11 +605,11 @@ uint8_t WS2812FX::getModeCount(void) {
   return MODE_COUNT;
 }
 
-uint8_t WS2812FX::getNumSegments(void) {
+segment_id_t WS2812FX::getNumSegments(void) {
   return _num_segments;
 }
 
-void WS2812FX::setNumSegments(uint8_t n) {
+void WS2812FX::setNumSegments(segment_id_t n) {
   _num_segments = n;
 }
 
@@ -363,11 +617,11 @@ uint32_t WS2812FX::getColor(void) {
   return getColor(0);
 }
 
-uint32_t WS2812FX::getColor(uint8_t seg) {
+uint32_t WS2812FX::getColor(segment_id_t seg) {
   return _segments[seg].colors[0];
 }
 
-uint32_t* WS2812FX::getColors(uint8_t seg) {
+uint32_t* WS2812FX::getColors(segment_id_t seg) {
   return _segments[seg].colors;
 }
 
@@ -375,7 +629,7 @@ WS2812FX::Segment* WS2812FX::getSegment(void) {
   return _seg;
 }
 
-WS2812FX::Segment* WS2812FX::getSegment(uint8_t seg) {
+WS2812FX::Segment* WS2812FX::getSegment(segment_id_t seg) {
   return &_segments[seg];
 }
 
@@ -387,17 +641,25 @@ WS2812FX::Segment_runtime* WS2812FX::getSegmentRuntime(void) {
   return _seg_rt;
 }
 
-WS2812FX::Segment_runtime* WS2812FX::getSegmentRuntime(uint8_t seg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr == NULL) return NULL; // segment not active
-  return &_segment_runtimes[ptr - _active_segments];
+WS2812FX::Segment_runtime* WS2812FX::getSegmentRuntime(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot == INACTIVE_SEGMENT) return NULL; // segment not active
+  return &_segment_runtimes[slot];
 }
 
 WS2812FX::Segment_runtime* WS2812FX::getSegmentRuntimes(void) {
   return _segment_runtimes;
 }
 
-uint8_t* WS2812FX::getActiveSegments(void) {
+#if !defined(MEGATINYCORE)
+// returns the time (millis()) an active segment's effect runs next, zero if the segment is not active
+unsigned long WS2812FX::getNextTime(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  return slot != INACTIVE_SEGMENT ? _next_times[slot] : 0;
+}
+#endif
+
+segment_id_t* WS2812FX::getActiveSegments(void) {
   return _active_segments;
 }
 
@@ -413,59 +675,71 @@ void WS2812FX::setSegment() {
   setSegment(0, 0, getLength()-1, DEFAULT_MODE, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n) {
+void WS2812FX::setSegment(segment_id_t n) {
   setSegment(n, 0, getLength()-1, DEFAULT_MODE, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start) {
   setSegment(n, start, getLength()-1, DEFAULT_MODE, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop) {
   setSegment(n, start, stop, DEFAULT_MODE, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode) {
   setSegment(n, start, stop, mode, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color) {
   setSegment(n, start, stop, mode, color, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed) {
   setSegment(n, start, stop, mode, color, speed, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed, bool reverse) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed, bool reverse) {
   setSegment(n, start, stop, mode, color, speed, (uint8_t)(reverse ? REVERSE : NO_OPTIONS));
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options) {
   uint32_t colors[] = {color, 0, 0};
   setSegment(n, start, stop, mode, colors, speed, options);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[]) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[]) {
   setSegment(n, start, stop, mode, colors, DEFAULT_SPEED, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed) {
   setSegment(n, start, stop, mode, colors, speed, NO_OPTIONS);
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, bool reverse) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, bool reverse) {
   setSegment(n, start, stop, mode, colors, speed, (uint8_t)(reverse ? REVERSE : NO_OPTIONS));
 }
 
-void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options) {
+void WS2812FX::setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options) {
   if(n < _segments_len) {
     if(n + 1 > _num_segments) _num_segments = n + 1;
+#if !defined(MEGATINYCORE)
+    if(_segments[n].start == start && _segments[n].stop == stop &&
+      (_segments[n].mode != mode || _segments[n].options != options) && _auto_transition != NULL) (this->*_auto_transition)(n);
+#endif
     _segments[n].start = start;
     _segments[n].stop = stop;
     _segments[n].mode = mode;
-    _segments[n].speed = speed;
     _segments[n].options = options;
+#if !defined(MEGATINYCORE)
+    if(_running && _transitions != NULL && _transitions[n].auto_duration && _segments[n].speed != speed) {
+      setSpeed(n, speed); // ramp to the new speed
+    } else {
+      _segments[n].speed = speed;
+    }
+#else
+    _segments[n].speed = speed;
+#endif
 
     setColors(n, (uint32_t*)colors);
 
@@ -473,88 +747,138 @@ void WS2812FX::setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode
   }
 }
 
-void WS2812FX::setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed) {
+void WS2812FX::setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed) {
   setIdleSegment(n, start, stop, mode, color, speed, NO_OPTIONS);
 }
 
-void WS2812FX::setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options) {
+void WS2812FX::setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options) {
   uint32_t colors[] = {color, 0, 0};
   setIdleSegment(n, start, stop, mode, colors, speed, options);
 }
 
-void WS2812FX::setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options) {
+void WS2812FX::setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options) {
   setSegment(n, start, stop, mode, colors, speed, options);
   if(n < _active_segments_len) removeActiveSegment(n);;
 }
 
-void WS2812FX::addActiveSegment(uint8_t seg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr != NULL) return; // segment already active
-  for(uint8_t i=0; i<_active_segments_len; i++) {
+void WS2812FX::addActiveSegment(segment_id_t seg) {
+  if(seg >= _segments_len || activeSlot(seg) != INACTIVE_SEGMENT) return; // segment already active
+#if !defined(MEGATINYCORE)
+  // the first empty slot is the lowest zero bit in the bitset
+  for(uint16_t w=0; w < (_active_segments_len + 31) / 32; w++) {
+    uint32_t bits = ~_active_bits[w];
+    if(bits == 0) continue;
+    uint32_t i = w * 32 + __builtin_ctzl(bits);
+    if(i >= _active_segments_len) break; // all slots in use
+    setActiveSlot(i, seg);
+    resetSegmentRuntime(seg);
+    break;
+  }
+#else
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
     if(_active_segments[i] == INACTIVE_SEGMENT) {
-      _active_segments[i] = seg;
+      setActiveSlot(i, seg);
       resetSegmentRuntime(seg);
       break;
     }
   }
+#endif
 }
 
-void WS2812FX::removeActiveSegment(uint8_t seg) {
-  for(uint8_t i=0; i<_active_segments_len; i++) {
-    if(_active_segments[i] == seg) {
-      _active_segments[i] = INACTIVE_SEGMENT;
-    }
-  }
+void WS2812FX::removeActiveSegment(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot != INACTIVE_SEGMENT) setActiveSlot(slot, INACTIVE_SEGMENT);
 }
 
-void WS2812FX::swapActiveSegment(uint8_t oldSeg, uint8_t newSeg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, newSeg, _active_segments_len);
-  if(ptr != NULL) return; // if newSeg is already active, don't swap
-  for(uint8_t i=0; i<_active_segments_len; i++) {
-    if(_active_segments[i] == oldSeg) {
-      _active_segments[i] = newSeg;
-
-      // reset all runtime parameters EXCEPT next_time,
-      // allowing the current animation frame to complete
-      __attribute__ ((unused)) segment_runtime seg_rt = _segment_runtimes[i];
-      seg_rt.counter_mode_step = 0;
-      seg_rt.counter_mode_call = 0;
-      seg_rt.aux_param = 0;
-      seg_rt.aux_param2 = 0;
-      seg_rt.aux_param3 = 0;
-      break;
-    }
-  }
+void WS2812FX::swapActiveSegment(segment_id_t oldSeg, segment_id_t newSeg) {
+  if(newSeg >= _segments_len || activeSlot(newSeg) != INACTIVE_SEGMENT) return; // if newSeg is already active, don't swap
+  segment_id_t slot = activeSlot(oldSeg);
+  if(slot == INACTIVE_SEGMENT) return;
+
+  // reset all runtime parameters EXCEPT next_time,
+  // allowing the current animation frame to complete
+  segment_runtime* seg_rt = &_segment_runtimes[slot];
+#if !defined(MEGATINYCORE)
+  if(_unroll_ring != NULL) (this->*_unroll_ring)(oldSeg, seg_rt);
+#endif
+  seg_rt->counter_mode_step = 0;
+  seg_rt->counter_mode_call = 0;
+  seg_rt->aux_param = 0;
+  seg_rt->aux_param2 = 0;
+  seg_rt->aux_param3 = 0;
+
+  setActiveSlot(slot, newSeg);
 }
 
-bool WS2812FX::isActiveSegment(uint8_t seg) {
+bool WS2812FX::isActiveSegment(segment_id_t seg) {
+  return activeSlot(seg) != INACTIVE_SEGMENT;
+}
+
+/*
+ * Returns the index of a segment in the _active_segments array (which is also
+ * the index of its runtime), or INACTIVE_SEGMENT if the segment is idle.
+ */
+segment_id_t WS2812FX::activeSlot(segment_id_t seg) {
+#if !defined(MEGATINYCORE)
+  return seg < _segments_len ? _segment_slots[seg] : INACTIVE_SEGMENT;
+#else
   uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr != NULL) return true;
-  return false;
+  return ptr != NULL ? ptr - _active_segments : INACTIVE_SEGMENT;
+#endif
+}
+
+/*
+ * Puts a segment (or INACTIVE_SEGMENT) in one of the _active_segments slots,
+ * keeping the segment to slot map and the active slot bitset up to date.
+ */
+void WS2812FX::setActiveSlot(segment_id_t slot, segment_id_t seg) {
+#if !defined(MEGATINYCORE)
+  segment_id_t oldSeg = _active_segments[slot];
+  if(oldSeg < _segments_len) _segment_slots[oldSeg] = INACTIVE_SEGMENT;
+  if(seg < _segments_len) {
+    _segment_slots[seg] = slot;
+    _active_bits[slot / 32] |= (uint32_t)1 << (slot % 32);
+  } else {
+    _active_bits[slot / 32] &= ~((uint32_t)1 << (slot % 32));
+  }
+#endif
+  _active_segments[slot] = seg;
 }
 
 void WS2812FX::resetSegments() {
   resetSegmentRuntimes();
   memset(_segments, 0, _segments_len * sizeof(Segment));
-  memset(_active_segments, INACTIVE_SEGMENT, _active_segments_len);
+  memset(_active_segments, 0xFF, _active_segments_len * sizeof(segment_id_t)); // all INACTIVE_SEGMENT
+#if !defined(MEGATINYCORE)
+  memset(_segment_slots, 0xFF, _segments_len * sizeof(segment_id_t));
+  memset(_active_bits, 0, (_active_segments_len + 31) / 32 * sizeof(uint32_t));
+#endif
   _num_segments = 0;
 }
 
 void WS2812FX::resetSegmentRuntimes() {
-  for(uint8_t i=0; i<_segments_len; i++) {
+  for(segment_id_t i=0; i<_segments_len; i++) {
     resetSegmentRuntime(i);
   };
 }
 
-void WS2812FX::resetSegmentRuntime(uint8_t seg) {
-  uint8_t* ptr = (uint8_t*)memchr(_active_segments, seg, _active_segments_len);
-  if(ptr == NULL) return; // segment not active
-  _segment_runtimes[seg].next_time = 0;
-  _segment_runtimes[seg].counter_mode_step = 0;
-  _segment_runtimes[seg].counter_mode_call = 0;
-  _segment_runtimes[seg].aux_param = 0;
-  _segment_runtimes[seg].aux_param2 = 0;
-  _segment_runtimes[seg].aux_param3 = 0;
+void WS2812FX::resetSegmentRuntime(segment_id_t seg) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot == INACTIVE_SEGMENT) return; // segment not active
+  segment_runtime* seg_rt = &_segment_runtimes[slot]; // runtimes are indexed by active slot
+#if !defined(MEGATINYCORE)
+  _next_times[slot] = 0;
+#else
+  seg_rt->next_time = 0;
+#endif
+  seg_rt->counter_mode_step = 0;
+  seg_rt->counter_mode_call = 0;
+  seg_rt->aux_param = 0;
+  seg_rt->aux_param2 = 0;
+  seg_rt->aux_param3 = 0;
+#if !defined(MEGATINYCORE)
+  if(_unroll_ring != NULL) (this->*_unroll_ring)(seg, seg_rt);
+#endif
   // don't reset any external data source
 }
 
@@ -631,12 +955,23 @@ uint16_t WS2812FX::random16(uint16_t lim) {
   return r;
 }
 
+#if !defined(MEGATINYCORE)
+// note randomIndex(lim) generates numbers in the range 0 to (lim - 1),
+// for picking LEDs in segments that may be longer than 65535 LEDs
+pixel_index_t WS2812FX::randomIndex(pixel_index_t lim) {
+#if PIXEL_INDEX_BITS == 32
+  if(lim > 65535) return (((uint64_t)random16() << 16 | random16()) * lim) >> 32;
+#endif
+  return random16(lim);
+}
+#endif
+
 // Return the sum of all LED intensities (can be used for
 // rudimentary power calculations)
 uint32_t WS2812FX::intensitySum() {
   uint8_t *pixels = getPixels();
   uint32_t sum = 0;
-  for(uint16_t i=0; i <numBytes; i++) {
+  for(pixel_index_t i=0; i <numBytes; i++) {
     sum+= pixels[i];
   }
   return sum;
@@ -652,7 +987,7 @@ uint32_t* WS2812FX::intensitySums() {
 
   uint8_t *pixels = getPixels();
   uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
-  for(uint16_t i=0; i <numBytes; i += bytesPerPixel) {
+  for(pixel_index_t i=0; i <numBytes; i += bytesPerPixel) {
     intensities[0] += pixels[i];
     intensities[1] += pixels[i + 1];
     intensities[2] += pixels[i + 2];
@@ -693,7 +1028,9 @@ void WS2812FX::setCustomShow(void (*p)()) {
 /*
  * set a segment runtime's external data source
  */
-void WS2812FX::setExtDataSrc(uint8_t seg, uint8_t *src, uint8_t cnt) {
-  _segment_runtimes[seg].extDataSrc = src;
-  _segment_runtimes[seg].extDataCnt = cnt;
+void WS2812FX::setExtDataSrc(segment_id_t seg, uint8_t *src, uint8_t cnt) {
+  segment_id_t slot = activeSlot(seg);
+  if(slot == INACTIVE_SEGMENT) return; // segment not active
+  _segment_runtimes[slot].extDataSrc = src;
+  _segment_runtimes[slot].extDataCnt = cnt;
 }
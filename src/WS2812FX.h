@@ -65,13 +65,61 @@
 #define BRIGHTNESS_MIN (uint8_t)0
 #define BRIGHTNESS_MAX (uint8_t)255
 
-/* each segment uses 36 bytes of SRAM memory, so if you're compile fails
+// default power model (see setPowerModel()), determined empirically for
+// typical WS2812 LEDs. You may need to adjust these to match your hardware.
+#define DEFAULT_QUIESCENT_CURRENT   (uint16_t)1000 /* current draw of one LED that's off (uA) */
+#define DEFAULT_INCREMENTAL_CURRENT (uint16_t)40   /* increase in current for each intensity step per color (uA) */
+#define DEFAULT_VOLTAGE             (uint16_t)5000 /* supply voltage (mV), used for energy estimates */
+#define THERMAL_BUCKETS             8   /* number of sub-windows in the thermal model's rolling window */
+#define THROTTLE_STEP_TIME          20  /* time between thermal throttle adjustments (ms) */
+#define THERMAL_MIN_THROTTLE        32  /* default lowest thermal throttle, so the strip is dimmed but never blanked */
+#define OUTPUT_INTERVAL             10  /* time between shows while the output stage is ramping (ms) */
+
+/* each segment uses 40 bytes of SRAM memory, so if you're compile fails
   because of insufficient flash memory, decreasing MAX_NUM_SEGMENTS may help */
 #define MAX_NUM_SEGMENTS         10
 #define MAX_NUM_ACTIVE_SEGMENTS  10
-#define INACTIVE_SEGMENT        255 /* max uint_8 */
+
+/* segment ids are 16-bit on boards with the RAM for more than 254 segments.
+  Add -DSEGMENT_ID_BITS=8 (or 16) to the build flags to override the default. */
+#if !defined(SEGMENT_ID_BITS)
+  #if defined(ESP8266) || defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+    #define SEGMENT_ID_BITS 16
+  #else
+    #define SEGMENT_ID_BITS 8
+  #endif
+#endif
+#if SEGMENT_ID_BITS == 16 && !defined(MEGATINYCORE)
+  typedef uint16_t segment_id_t;
+  #define INACTIVE_SEGMENT    65535 /* max uint_16 */
+#else
+  typedef uint8_t segment_id_t;
+  #define INACTIVE_SEGMENT      255 /* max uint_8 */
+#endif
+
+/* pixel indices are 32-bit on boards with the RAM for strips of more than 65535 LEDs.
+  Add -DPIXEL_INDEX_BITS=16 (or 32) to the build flags to override the default. */
+#if !defined(PIXEL_INDEX_BITS)
+  #if defined(ESP8266) || defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+    #define PIXEL_INDEX_BITS 32
+  #else
+    #define PIXEL_INDEX_BITS 16
+  #endif
+#endif
+#if PIXEL_INDEX_BITS == 32 && !defined(MEGATINYCORE)
+  typedef uint32_t pixel_index_t;
+#else
+  #undef  PIXEL_INDEX_BITS
+  #define PIXEL_INDEX_BITS 16
+  typedef uint16_t pixel_index_t;
+#endif
 #define MAX_NUM_COLORS            3 /* number of colors per segment */
 #define MAX_CUSTOM_MODES          8
+#define MAX_NUM_LAYERS            4 /* number of effect layers that can be stacked on segments */
+#define MAX_NUM_OUTPUTS          16 /* number of physical LED strips the pixel data can be sent to */
+#define REMAP_NONE            65535 /* remap table entry for LEDs that don't show any pixel */
+#define REMAP_RUN_NONE        ((pixel_index_t)-1) /* remap run start for LEDs that don't show any pixel, on strips of any length */
+#define SPATIAL_BUCKET_BITS       3 /* the spatial index has 2^3 x 2^3 x 2^3 buckets */
 
 // some common colors
 #define RED        (uint32_t)0xFF0000
@@ -95,7 +143,7 @@
 // bits 4-6: fade rate (0-7)
 // bit    3: gamma correction
 // bits 1-2: size
-// bits   0: TBD
+// bit    0: mirror animation
 #define NO_OPTIONS   (uint8_t)0b00000000
 #define REVERSE      (uint8_t)0b10000000
 #define IS_REVERSE   ((_seg->options & REVERSE) == REVERSE)
@@ -114,6 +162,48 @@
 #define SIZE_LARGE   (uint8_t)0b00000100
 #define SIZE_XLARGE  (uint8_t)0b00000110
 #define SIZE_OPTION  ((_seg->options >> 1) & 3)
+#define MIRROR       (uint8_t)0b00000001
+#define IS_MIRROR    ((_seg->options & MIRROR) == MIRROR)
+
+// layer blend modes
+#define BLEND_ALPHA  (uint8_t)0 /* mix the layer with the segment below, by the layer's opacity */
+#define BLEND_ADD    (uint8_t)1 /* add the layer to the segment below */
+#define BLEND_MAX    (uint8_t)2 /* keep the brighter of the layer and the segment below */
+#define BLEND_SCREEN (uint8_t)3 /* brighten the segment below by the layer, without saturating */
+
+// transition styles (bits 0-3) and easing (bits 4-5)
+#define TRANSITION_FADE     (uint8_t)0x00 /* crossfade from the old effect to the new */
+#define TRANSITION_WIPE     (uint8_t)0x01 /* wipe the new effect over the old */
+#define TRANSITION_DISSOLVE (uint8_t)0x02 /* switch LEDs over to the new effect in random order */
+#define TRANSITION_PUSH     (uint8_t)0x03 /* slide the new effect in, pushing the old effect out */
+#define EASE_LINEAR         (uint8_t)0x00
+#define EASE_IN             (uint8_t)0x10
+#define EASE_OUT            (uint8_t)0x20
+#define EASE_IN_OUT         (uint8_t)0x30
+
+// frame cache states
+#define CACHE_RECORDING     (uint8_t)0x00
+#define CACHE_REPLAYING     (uint8_t)0x01
+#define CACHE_FAILED        (uint8_t)0x02
+
+// show cue options
+#define CUE_MS              (uint8_t)0x00 /* the cue's duration is in ms */
+#define CUE_CYCLES          (uint8_t)0x01 /* the cue's duration is a number of cycles of the cue's first segment */
+#define NO_CUE              255
+
+// memory policy, the buffers that are put in PSRAM (ESP32 boards with PSRAM)
+#define PSRAM_NONE          (uint8_t)0x00 /* allocate every buffer with malloc() */
+#define PSRAM_PIXELS        (uint8_t)0x01 /* the pixel data the effects render into */
+#define PSRAM_BUFFERS       (uint8_t)0x02 /* the output stage, transition and layer buffers */
+#define PSRAM_ALL           (uint8_t)0x03
+
+// matrix layouts
+#define MATRIX_PROGRESSIVE  (uint8_t)0x00 /* all rows are wired in the same direction */
+#define MATRIX_SERPENTINE   (uint8_t)0x01 /* every other row is wired in the opposite direction */
+
+// render scale upsampling
+#define SCALE_NEAREST       (uint8_t)0x00 /* each rendered pixel is shown on a block of LEDs */
+#define SCALE_LINEAR        (uint8_t)0x80 /* LEDs between rendered pixels are interpolated */
 
 // segment runtime options (aux_param2)
 #define FRAME           (uint8_t)0b10000000
@@ -185,6 +275,9 @@ class WS2812FX : public tinyNeoPixel {
     // a dummy function so the WS2812FX lib can compile.
     void updateLength(uint16_t n) { return; };
 
+    // ATtiny strips are never longer than 65535 LEDs
+    uint16_t randomIndex(uint16_t lim) { return random16(lim); };
+
     void
 //    timer(void),
       init(void),
@@ -250,6 +343,7 @@ class WS2812FX : public tinyNeoPixel {
       setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w),
       setRawPixelColor(uint16_t n, uint32_t c),
       copyPixels(uint16_t d, uint16_t s, uint16_t c),
+      shiftPixels(uint32_t c),
       setPixels(uint16_t, uint8_t*),
       setRandomSeed(uint16_t),
       setExtDataSrc(uint8_t seg, uint8_t *src, uint8_t cnt),
@@ -443,39 +537,178 @@ class WS2812FX : public tinyNeoPixel {
     segment_runtime* _seg_rt = _segment_runtimes;  // currently active segment runtime (16 bytes)
 
     uint16_t _seg_len;                  // num LEDs in the currently active segment
+
+    uint8_t activeSlot(uint8_t);
+    void setActiveSlot(uint8_t, uint8_t);
 };
 #else
+// a physical LED strip, that gets its pixel data from a range of the WS2812FX strip's pixel data
+class WS2812FXOutput : public Adafruit_NeoPixel {
+
+  public:
+    WS2812FXOutput(uint16_t num_leds, int16_t pin, neoPixelType type, pixel_index_t offset, uint8_t options)
+      : Adafruit_NeoPixel(num_leds, pin, type) {
+      _offset = offset;
+      _options = options;
+    };
+
+    void
+      useSpan(void),
+      setStaged(bool isStaged),
+      update(const uint8_t* src, pixel_index_t srcNumLEDs, uint8_t srcR, uint8_t srcG, uint8_t srcB, uint8_t srcW, uint8_t* stage);
+
+    pixel_index_t getOffset(void) { return _offset; };
+
+    uint16_t getNumBytes(void) { return numBytes; };
+
+    uint8_t getOptions(void) { return _options; };
+
+    bool isSpan(void) { return _is_span; };
+
+  private:
+    pixel_index_t _offset;  // index of the strip's first LED in the WS2812FX pixel data
+    uint8_t  _options;      // REVERSE
+    bool     _is_span = false; // true if the strip sends the WS2812FX pixel data without copying it
+};
+
 class WS2812FX : public Adafruit_NeoPixel {
 
   public:
     typedef uint16_t (WS2812FX::*mode_ptr)(void);
 
     // segment parameters
-    typedef struct Segment { // 20 bytes
-      uint16_t start;
-      uint16_t stop;
+    typedef struct Segment { // 24 bytes, 32 bytes with 32-bit pixel indices
+      pixel_index_t start;
+      pixel_index_t stop;
       uint16_t speed;
       uint8_t  mode;
       uint8_t  options;
       uint32_t colors[MAX_NUM_COLORS];
+      uint8_t  priority;    // power budget priority (higher priority segments are dimmed last)
+      uint8_t  dimming;     // amount the output stage dims the segment (0 = full brightness)
+      pixel_index_t offset; // number of LEDs the output stage rotates the segment by
     } segment;
 
     // segment runtime parameters
-    typedef struct Segment_runtime { // 20 bytes for Arduino, 24 bytes for ESP
-      unsigned long next_time;
+    // (a segment's next_time is kept in the _next_times array, see getNextTime())
+    typedef struct Segment_runtime { // 18 bytes for Arduino, 24 bytes for ESP
       uint32_t counter_mode_step;
       uint32_t counter_mode_call;
       uint8_t  aux_param;   // auxilary param (usually stores a color_wheel index)
       uint8_t  aux_param2;  // auxilary param (usually stores bitwise options)
-      uint16_t aux_param3;  // auxilary param (usually stores a segment index)
-      uint8_t* extDataSrc = NULL; // external data array
       uint16_t extDataCnt = 0;    // number of elements in the external data array
+      pixel_index_t aux_param3;   // auxilary param (usually stores a segment index)
+      uint8_t* extDataSrc = NULL; // external data array
+      pixel_index_t head = 0;     // ring buffer head of effects that scroll with shiftPixels()
     } segment_runtime;
 
-    WS2812FX(uint16_t num_leds, uint8_t pin, neoPixelType type,
-      uint8_t max_num_segments=MAX_NUM_SEGMENTS,
-      uint8_t max_num_active_segments=MAX_NUM_ACTIVE_SEGMENTS)
-      : Adafruit_NeoPixel(num_leds, pin, type) {
+    // segment power estimate
+    typedef struct Segment_power { // 8 bytes
+      uint32_t current;     // estimated current draw (mA)
+      uint8_t  scale;       // scaling factor applied by the power budget (255 = full brightness)
+    } segment_power;
+
+    // effect layer, stacked on top of a segment
+    typedef struct Segment_layer {
+      segment         fx;       // the layer's mode, speed, colors and options (start and stop are not used)
+      segment_runtime rt;       // the layer's runtime parameters
+      unsigned long next_time;  // time the layer's effect runs next
+      uint8_t* pixels;          // the layer's pixel data, allocated by service()
+      pixel_index_t len;        // number of LEDs in the layer
+      segment_id_t seg;         // segment the layer is stacked on, INACTIVE_SEGMENT if the layer is not in use
+      uint8_t  blend;           // blend mode (BLEND_ALPHA, BLEND_ADD, BLEND_MAX or BLEND_SCREEN)
+      uint8_t  opacity;         // 0 = transparent, 255 = opaque
+    } segment_layer;
+
+    // segment transition, the outgoing effect is kept running until the transition is done
+    typedef struct Segment_transition {
+      segment         fx;       // the outgoing effect's mode, speed, colors and options
+      segment_runtime rt;       // the outgoing effect's runtime parameters
+      unsigned long   next_time;     // time the outgoing effect runs next
+      unsigned long   start_time;
+      unsigned long   speed_time;    // time the speed ramp started
+      uint16_t        duration;      // length of the transition (ms), zero if no transition is in progress
+      uint16_t        from_speed;    // speed being ramped from
+      uint16_t        to_speed;      // speed being ramped to, zero if the speed isn't being ramped
+      uint16_t        auto_duration; // length of automatic transitions (ms), zero if they're disabled
+      uint8_t         style;         // transition style and easing
+      uint8_t         auto_style;    // style and easing of automatic transitions
+      bool            shown;         // true once the transition has been shown
+    } segment_transition;
+
+    // run of LEDs in a run-length encoded remap table
+    typedef struct Remap_run { // 6 bytes for Arduino, 12 bytes for ESP
+      pixel_index_t start; // pixel shown on the run's first LED, REMAP_RUN_NONE (or any pixel past the end of the strip) if the run's LEDs are unused
+      pixel_index_t len;   // number of LEDs in the run
+      uint8_t  options;    // REVERSE if the run's LEDs are wired in the opposite direction
+    } remap_run;
+
+    // matrix layout of a segment
+    typedef struct Segment_matrix { // 6 bytes
+      uint16_t width;   // number of LEDs in each row, zero if the segment isn't a matrix
+      uint16_t height;  // number of rows
+      uint8_t  options; // MATRIX_PROGRESSIVE or MATRIX_SERPENTINE
+    } segment_matrix;
+
+    // position of an LED, each coordinate spans the installation from -128 to 127
+    typedef struct Led_position { // 3 bytes
+      int8_t x;
+      int8_t y;
+      int8_t z;
+    } led_position;
+
+    // thermal model, a rolling window of current draw history
+    typedef struct Thermal_model {
+      uint64_t charges[THERMAL_BUCKETS]; // accumulated charge in each sub-window (mA*ms)
+      uint32_t window;          // length of the rolling window (ms)
+      uint32_t bucket_time;     // time accumulated in the current sub-window (ms)
+      uint16_t max_current;     // sustained current limit (mA)
+      uint16_t throttle_time;   // time accumulated since the last throttle adjustment (ms)
+      uint8_t  bucket;          // index of the current sub-window
+      uint8_t  throttle;        // throttle scaling factor (255 = not throttled)
+      uint8_t  min_throttle;    // lowest the throttle is allowed to go
+    } thermal_model;
+
+    // keyframe interpolation state of a segment
+    typedef struct Segment_keyframes {
+      uint8_t* pixels;          // the previous keyframe, followed by the interpolated frame
+      pixel_index_t size;       // number of bytes in each of the two frames
+      uint16_t interval;        // minimum time between keyframes (ms), zero if keyframes are off
+      uint16_t period;          // time between the last two keyframes (ms), zero until there are two keyframes
+      unsigned long time;       // time of the latest keyframe
+    } segment_keyframes;
+
+    // frame cache, one period of a segment's effect recorded for replay
+    typedef struct Frame_cache {
+      uint8_t* frames;          // recorded frames, allocated when recording starts
+      uint32_t budget;          // size of the frames buffer (bytes), zero if the cache is off
+      uint32_t size;            // number of bytes recorded
+      uint32_t pos;             // position of the next frame to replay
+      segment  fx;              // the segment settings the frames were recorded with
+      segment_runtime rt;       // the runtime expected the next time the effect runs
+      uint8_t  brightness;      // the brightness the frames were recorded with
+      uint8_t  scale;           // the render scale the frames were recorded with
+      uint8_t  state;           // CACHE_RECORDING, CACHE_REPLAYING or CACHE_FAILED
+    } frame_cache;
+
+    // show cue, a set of segments that run together for a while
+    typedef struct Show_cue {
+      segment_id_t first;       // first segment of the cue
+      segment_id_t count;       // number of segments, the cue runs segments first to first + count - 1
+      uint32_t duration;        // how long the cue runs, zero to hold the cue until the next startCue()
+      uint8_t  options;         // CUE_MS or CUE_CYCLES
+      uint16_t transition;      // length of the transition into the cue (ms), zero to switch at once
+      uint8_t  style;           // transition style and easing
+    } show_cue;
+
+    WS2812FX(pixel_index_t num_leds, uint8_t pin, neoPixelType type,
+      segment_id_t max_num_segments=MAX_NUM_SEGMENTS,
+      segment_id_t max_num_active_segments=MAX_NUM_ACTIVE_SEGMENTS)
+      : Adafruit_NeoPixel(PIXEL_INDEX_BITS == 32 ? 0 : num_leds, pin, type) {
+
+#if PIXEL_INDEX_BITS == 32
+      updateLength(num_leds); // Adafruit_NeoPixel can't allocate more than 65535 LEDs
+#endif
 
       brightness = DEFAULT_BRIGHTNESS + 1; // Adafruit_NeoPixel internally offsets brightness by 1
       _running = false;
@@ -485,8 +718,12 @@ class WS2812FX : public Adafruit_NeoPixel {
 
       // create all the segment arrays and init to zeros
       _segments = new segment[_segments_len]();
-      _active_segments = new uint8_t[_active_segments_len]();
+      _active_segments = new segment_id_t[_active_segments_len]();
       _segment_runtimes = new segment_runtime[_active_segments_len]();
+      _segment_slots = new segment_id_t[_segments_len]();
+      _active_bits = new uint32_t[(_active_segments_len + 31) / 32]();
+      _ran_bits = new uint32_t[(_active_segments_len + 31) / 32]();
+      _next_times = new unsigned long[_active_segments_len]();
 
       // init segment pointers
       _seg     = _segments;
@@ -496,6 +733,22 @@ class WS2812FX : public Adafruit_NeoPixel {
       setSegment(0, 0, num_leds - 1, DEFAULT_MODE, DEFAULT_COLOR, DEFAULT_SPEED, NO_OPTIONS);
     };
 
+#if PIXEL_INDEX_BITS == 32
+    // Adafruit_NeoPixel's LED count and pixel data size are 16-bit, so with 32-bit
+    // pixel indices WS2812FX keeps its own, and replaces the functions that use them
+    void updateLength(pixel_index_t n);
+
+    void clear(void) { memset(pixels, 0, numBytes); };
+
+    pixel_index_t numPixels(void) const { return numLEDs; };
+
+  protected:
+    pixel_index_t numLEDs = 0;
+    pixel_index_t numBytes = 0;
+
+  public:
+#endif
+
     void
 //    timer(void),
       init(void),
@@ -507,63 +760,98 @@ class WS2812FX : public Adafruit_NeoPixel {
       fade_out(void),
       fade_out(uint32_t),
       setMode(uint8_t m),
-      setMode(uint8_t seg, uint8_t m),
-      setOptions(uint8_t seg, uint8_t o),
+      setMode(segment_id_t seg, uint8_t m),
+      setOptions(segment_id_t seg, uint8_t o),
       setCustomMode(uint16_t (*p)()),
       setCustomShow(void (*p)()),
       setSpeed(uint16_t s),
-      setSpeed(uint8_t seg, uint16_t s),
+      setSpeed(segment_id_t seg, uint16_t s),
       increaseSpeed(uint8_t s),
       decreaseSpeed(uint8_t s),
       setColor(uint8_t r, uint8_t g, uint8_t b),
       setColor(uint8_t r, uint8_t g, uint8_t b, uint8_t w),
       setColor(uint32_t c),
-      setColor(uint8_t seg, uint32_t c),
-      setColors(uint8_t seg, uint32_t* c),
-      fill(uint32_t c, uint16_t f, uint16_t cnt),
+      setColor(segment_id_t seg, uint32_t c),
+      setColors(segment_id_t seg, uint32_t* c),
+      fill(uint32_t c, pixel_index_t f, pixel_index_t cnt),
       setBrightness(uint8_t b),
       increaseBrightness(uint8_t s),
       decreaseBrightness(uint8_t s),
-      setLength(uint16_t b),
-      increaseLength(uint16_t s),
-      decreaseLength(uint16_t s),
+      setLength(pixel_index_t b),
+      increaseLength(pixel_index_t s),
+      decreaseLength(pixel_index_t s),
       trigger(void),
       setCycle(void),
-      setNumSegments(uint8_t n),
+      setNumSegments(segment_id_t n),
 
       setSegment(),
-      setSegment(uint8_t n),
-      setSegment(uint8_t n, uint16_t start),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed, bool reverse),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options),
-
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[]),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, bool reverse),
-      setSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options),
-
-      setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color,          uint16_t speed),
-      setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, uint32_t color,          uint16_t speed, uint8_t options),
-      setIdleSegment(uint8_t n, uint16_t start, uint16_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options),
-      addActiveSegment(uint8_t seg),
-      removeActiveSegment(uint8_t seg),
-      swapActiveSegment(uint8_t oldSeg, uint8_t newSeg),
+      setSegment(segment_id_t n),
+      setSegment(segment_id_t n, pixel_index_t start),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed, bool reverse),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color, uint16_t speed, uint8_t options),
+
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[]),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, bool reverse),
+      setSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options),
+
+      setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color,          uint16_t speed),
+      setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, uint32_t color,          uint16_t speed, uint8_t options),
+      setIdleSegment(segment_id_t n, pixel_index_t start, pixel_index_t stop, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options),
+      addActiveSegment(segment_id_t seg),
+      removeActiveSegment(segment_id_t seg),
+      swapActiveSegment(segment_id_t oldSeg, segment_id_t newSeg),
 
       resetSegments(void),
       resetSegmentRuntimes(void),
-      resetSegmentRuntime(uint8_t),
-      setPixelColor(uint16_t n, uint32_t c),
-      setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b),
-      setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w),
-      setRawPixelColor(uint16_t n, uint32_t c),
-      copyPixels(uint16_t d, uint16_t s, uint16_t c),
-      setPixels(uint16_t, uint8_t*),
+      resetSegmentRuntime(segment_id_t),
+      setPixelColor(pixel_index_t n, uint32_t c),
+      setPixelColor(pixel_index_t n, uint8_t r, uint8_t g, uint8_t b),
+      setPixelColor(pixel_index_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w),
+      setRawPixelColor(pixel_index_t n, uint32_t c),
+      copyPixels(pixel_index_t d, pixel_index_t s, pixel_index_t c),
+      shiftPixels(uint32_t c),
+      setPixels(pixel_index_t, uint8_t*),
       setRandomSeed(uint16_t),
-      setExtDataSrc(uint8_t seg, uint8_t *src, uint8_t cnt),
+      setExtDataSrc(segment_id_t seg, uint8_t *src, uint8_t cnt),
+      setMaxCurrent(uint16_t mA),
+      setPowerModel(uint16_t quiescent, uint16_t incremental),
+      setPriority(segment_id_t seg, uint8_t p),
+      setSegmentBrightness(segment_id_t seg, uint8_t b),
+      setSegmentOffset(segment_id_t seg, pixel_index_t offset),
+      setSegmentScale(segment_id_t seg, uint8_t factor, uint8_t options = SCALE_NEAREST),
+      setBrightnessRamp(uint16_t ms),
+      setLayer(uint8_t n, segment_id_t seg, uint8_t mode, uint32_t color, uint16_t speed, uint8_t blend),
+      setLayer(uint8_t n, segment_id_t seg, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options, uint8_t blend),
+      setLayerOpacity(uint8_t n, uint8_t opacity),
+      removeLayer(uint8_t n),
+      startTransition(segment_id_t seg, uint16_t duration, uint8_t style),
+      setAutoTransition(segment_id_t seg, uint16_t duration, uint8_t style),
+      setOutput(uint8_t n, int16_t pin, pixel_index_t offset, uint16_t len, neoPixelType type),
+      setOutput(uint8_t n, int16_t pin, pixel_index_t offset, uint16_t len, neoPixelType type, uint8_t options),
+      setRemap(const uint16_t map[], uint16_t len),
+      setRemap(const remap_run runs[], uint16_t numRuns),
+      removeRemap(void),
+      setMatrix(segment_id_t seg, uint16_t width, uint16_t height, uint8_t options),
+      removeMatrix(segment_id_t seg),
+      setPositions(const led_position positions[], uint16_t count),
+      setSpatialDirection(int8_t x, int8_t y, int8_t z),
+      setKeyframeInterval(segment_id_t seg, uint16_t ms),
+      setDedupe(bool enable),
+      setFrameCache(segment_id_t seg, uint32_t bytes),
+      setCues(const show_cue cues[], uint8_t count, bool loop),
+      removeCues(void),
+      startCue(uint8_t n),
+      nextCue(void),
+      setThermalLimit(uint16_t mA, uint32_t window, uint8_t minThrottle = THERMAL_MIN_THROTTLE),
+      setPowerOnRamp(uint16_t ms),
+      setVoltage(uint16_t mV),
+      resetEnergy(void),
+      setMemoryPolicy(uint8_t policy),
       execShow(void);
 
     bool
@@ -571,57 +859,107 @@ class WS2812FX : public Adafruit_NeoPixel {
       isRunning(void),
       isTriggered(void),
       isFrame(void),
-      isFrame(uint8_t),
+      isFrame(segment_id_t),
       isCycle(void),
-      isCycle(uint8_t),
-      isActiveSegment(uint8_t seg);
+      isCycle(segment_id_t),
+      isActiveSegment(segment_id_t seg),
+      isTransitioning(segment_id_t seg),
+      isDeduped(segment_id_t seg),
+      isCached(segment_id_t seg);
 
     uint8_t
       random8(void),
       random8(uint8_t),
       getMode(void),
-      getMode(uint8_t),
+      getMode(segment_id_t),
       getModeCount(void),
       setCustomMode(const __FlashStringHelper* name, uint16_t (*p)()),
       setCustomMode(uint8_t i, const __FlashStringHelper* name, uint16_t (*p)()),
-      getNumSegments(void),
       get_random_wheel_index(uint8_t),
-      getOptions(uint8_t),
+      getOptions(segment_id_t),
+      getPriority(segment_id_t),
+      getThrottle(void),
+      getBrightness(void),
+      getSegmentBrightness(segment_id_t),
+      getSegmentScale(segment_id_t),
+      getCue(void),
+      getMemoryPolicy(void),
       getNumBytesPerPixel(void);
 
     uint16_t
       random16(void),
       random16(uint16_t),
       getSpeed(void),
-      getSpeed(uint8_t),
+      getSpeed(segment_id_t),
+      getMaxCurrent(void),
+      getKeyframeInterval(segment_id_t);
+
+    pixel_index_t
+      randomIndex(pixel_index_t),
       getLength(void),
-      getNumBytes(void);
+      getNumBytes(void),
+      getSegmentOffset(segment_id_t);
 
     uint32_t
       color_wheel(uint8_t),
       getColor(void),
-      getColor(uint8_t),
+      getColor(segment_id_t),
+      getCurrent(void),
+      getCurrent(segment_id_t),
+      getAverageCurrent(void),
       intensitySum(void);
 
-    uint32_t* getColors(uint8_t);
+    float getEnergy(void);
+
+    unsigned long getNextTime(segment_id_t);
+
+    static bool isPSRAM(const void* ptr);
+
+    uint32_t* getColors(segment_id_t);
     uint32_t* intensitySums(void);
-    uint8_t*  getActiveSegments(void);
-    uint8_t*  blend(uint8_t*, uint8_t*, uint8_t*, uint16_t, uint8_t);
+    segment_id_t  getNumSegments(void);
+    segment_id_t* getActiveSegments(void);
+    uint8_t*  blend(uint8_t*, uint8_t*, uint8_t*, pixel_index_t, uint8_t);
 
     const __FlashStringHelper* getModeName(uint8_t m);
 
     WS2812FX::Segment* getSegment(void);
 
-    WS2812FX::Segment* getSegment(uint8_t);
+    WS2812FX::Segment* getSegment(segment_id_t);
 
     WS2812FX::Segment* getSegments(void);
 
     WS2812FX::Segment_runtime* getSegmentRuntime(void);
 
-    WS2812FX::Segment_runtime* getSegmentRuntime(uint8_t);
+    WS2812FX::Segment_runtime* getSegmentRuntime(segment_id_t);
 
     WS2812FX::Segment_runtime* getSegmentRuntimes(void);
 
+    WS2812FX::Segment_layer* getLayer(uint8_t);
+
+    WS2812FXOutput* getOutput(uint8_t);
+
+    WS2812FX::Segment_matrix* getMatrix(segment_id_t);
+
+    WS2812FX::Led_position getPosition(pixel_index_t n);
+
+    uint16_t getNeighbors(uint16_t n, uint8_t radius, uint16_t neighbors[], uint16_t max);
+
+    // matrix helper functions, for effects running on a matrix segment
+    uint16_t
+      getMatrixWidth(void),
+      getMatrixHeight(void);
+
+    pixel_index_t XY(uint16_t x, uint16_t y);
+
+    void
+      setPixelColorXY(uint16_t x, uint16_t y, uint32_t c),
+      fillRow(uint16_t y, uint32_t c),
+      fillColumn(uint16_t x, uint32_t c),
+      scrollMatrix(int16_t dx, int16_t dy);
+
+    uint32_t getPixelColorXY(uint16_t x, uint16_t y);
+
     // mode helper functions
     uint16_t
       blink(uint32_t, uint32_t, bool strobe),
@@ -639,7 +977,8 @@ class WS2812FX : public Adafruit_NeoPixel {
 
     uint32_t
       color_blend(uint32_t, uint32_t, uint8_t),
-      getRawPixelColor(uint16_t n);
+      getPixelColor(pixel_index_t n),
+      getRawPixelColor(pixel_index_t n);
 
     // builtin modes
     uint16_t
@@ -715,6 +1054,15 @@ class WS2812FX : public Adafruit_NeoPixel {
       mode_flipbook(void),
       mode_popcorn(void),
       mode_oscillator(void),
+      mode_matrix_rain(void),
+      mode_plasma(void),
+      mode_matrix_fire(void),
+      mode_matrix_scroll(void),
+      mode_plane_sweep(void),
+      mode_spheres(void),
+      mode_noise_field(void),
+      mode_spatial_wipe(void),
+      mode_clip(void),
       mode_custom_0(void),
       mode_custom_1(void),
       mode_custom_2(void),
@@ -742,25 +1090,149 @@ class WS2812FX : public Adafruit_NeoPixel {
       _running,
       _triggered;
 
-    segment* _segments;                 // array of segments (20 bytes per element)
+    segment* _segments;                 // array of segments (24 bytes per element)
     segment_runtime* _segment_runtimes; // array of segment runtimes (16 bytes per element)
-    uint8_t* _active_segments;          // array of active segments (1 bytes per element)
-
-    uint8_t _segments_len = 0;          // size of _segments array
-    uint8_t _active_segments_len = 0;   // size of _segments_runtime and _active_segments arrays
-    uint8_t _num_segments = 0;          // number of configured segments in the _segments array
-
-    segment* _seg;                      // currently active segment (20 bytes)
+    segment_id_t* _active_segments;     // array of active segments
+    segment_id_t* _segment_slots;       // for each segment, its index in the _active_segments array, INACTIVE_SEGMENT if it's idle
+    uint32_t* _active_bits;             // bitset of the _active_segments elements that hold an active segment
+    uint32_t* _ran_bits;                // bitset of the active segments that ran in the last service() call
+    unsigned long* _next_times;         // each active segment's next_time, kept apart so service() can check which segments are due without touching the rest
+
+    // service() and execShow() only call a feature's code through its hook, which is set by
+    // the function that turns the feature on, so sketches don't link the features they don't use
+    bool (WS2812FX::*_encode_output)(void) = NULL;                    // set by initOutput()
+    void (WS2812FX::*_unroll_ring)(segment_id_t, segment_runtime*) = NULL; // set by initOutput()
+    void (WS2812FX::*_show_outputs)(void) = NULL;                     // set by setOutput()
+    void (WS2812FX::*_service_cues)(unsigned long) = NULL;            // set by setCues()
+    void (WS2812FX::*_chain_twins)(unsigned long, segment_id_t) = NULL; // set by setDedupe()
+    void (WS2812FX::*_dedupe_segment)(segment_id_t, const segment_runtime*, unsigned long) = NULL; // set by setDedupe()
+    void (WS2812FX::*_capture_keyframe)(segment_id_t) = NULL;         // set by setKeyframeInterval()
+    uint16_t (WS2812FX::*_run_cached)(segment_id_t) = NULL;           // set by setFrameCache()
+    bool (WS2812FX::*_service_layers)(unsigned long) = NULL;          // set by setLayer()
+    bool (WS2812FX::*_service_transitions)(unsigned long) = NULL;     // set by initTransitions() and setAutoTransition()
+    void (WS2812FX::*_auto_transition)(segment_id_t) = NULL;          // set by setAutoTransition()
+
+    segment_id_t _segments_len = 0;     // size of _segments array
+    segment_id_t _active_segments_len = 0; // size of the _segment_runtimes and _active_segments arrays
+    segment_id_t _num_segments = 0;     // number of configured segments in the _segments array
+
+    segment* _seg;                      // currently active segment (24 bytes)
     segment_runtime* _seg_rt;           // currently active segment runtime (16 bytes)
 
-    uint16_t _seg_len;                  // num LEDs in the currently active segment
+    pixel_index_t _seg_len;             // num LEDs in the currently active segment
+
+    uint8_t* _out_pixels = NULL;        // output buffer, allocated once the output stage is in use
+    pixel_index_t _out_num_bytes = 0;   // size of the _out_pixels array
+    uint8_t  _brightness = 0;           // global brightness, once the output stage has taken it over from Adafruit_NeoPixel
+    uint8_t  _target_brightness = 0;    // global brightness being ramped to
+    uint8_t  _start_brightness = 0;     // global brightness being ramped from
+    uint16_t _brightness_ramp = 0;      // duration of global brightness changes (ms)
+    unsigned long _brightness_time = 0; // time of the last global brightness change
+    bool _output_pending = false;       // true while the output stage needs the LEDs refreshed
+
+    uint16_t _max_current = 0;          // power budget (mA), zero if the power budget is disabled
+    uint16_t _quiescent_current = DEFAULT_QUIESCENT_CURRENT;
+    uint16_t _incremental_current = DEFAULT_INCREMENTAL_CURRENT;
+    uint32_t _current = 0;              // estimated current draw of the entire strip (mA)
+    segment_power* _segment_powers = NULL; // array of segment power estimates (8 bytes per element)
+    thermal_model* _thermal = NULL;     // thermal model, allocated only if a thermal limit is set
+
+    uint16_t _voltage = DEFAULT_VOLTAGE;
+    uint16_t _power_on_ramp = 0;        // duration of the power-on brightness ramp (ms)
+    uint32_t _charge = 0;               // accumulated charge not yet added to _energy (mA*ms)
+    uint64_t _energy = 0;               // accumulated charge (uAh), 64-bit so it never wraps
+    unsigned long _power_on_time = 0;   // time the strip was started
+    unsigned long _power_time = 0;      // time of the last power estimate
+    unsigned long _show_time = 0;       // time of the last show
+
+    segment_layer* _layers = NULL;      // array of effect layers, allocated when the first layer is set
+    segment_transition* _transitions = NULL; // array of segment transitions, allocated when the first transition starts
+    uint8_t* _scratch_pixels = NULL;    // pixel data of the outgoing effects of segments in transition
+    pixel_index_t _scratch_num_bytes = 0; // size of the _scratch_pixels array
+
+    uint8_t  _memory_policy = PSRAM_NONE; // the buffers that are put in PSRAM
+    uint8_t* _stage_pixels = NULL;      // internal RAM copy of pixel data in PSRAM, for sending to the LEDs
+    pixel_index_t _stage_num_bytes = 0; // size of the _stage_pixels array
+
+    WS2812FXOutput** _outputs = NULL;   // array of physical LED strips, allocated when the first output is set
+
+    const uint16_t* _remap = NULL;      // remap table, the pixel shown on each LED
+    const remap_run* _remap_runs = NULL; // run-length encoded remap table
+    uint16_t _remap_len = 0;            // number of entries in the remap table
+    uint8_t* _map_pixels = NULL;        // second output buffer, the remapped pixel data is written here
+
+    segment_matrix* _matrices = NULL;   // array of segment matrix layouts, allocated when the first matrix is set
+    segment_matrix* _seg_matrix = NULL; // matrix layout of the currently active segment
+    pixel_index_t _seg_origin = 0;      // index of the currently active segment's first LED in the strip
+
+    uint8_t* _scales = NULL;            // array of segment render scales, allocated when the first scale is set
+    uint8_t  _seg_scale = 1;            // render scale of the currently active segment
+
+    segment_keyframes* _keyframes = NULL; // array of segment keyframe states, allocated when the first keyframe interval is set
+
+    segment_id_t* _twins = NULL;        // for each active segment, the active segment it was copied from, allocated when dedupe is enabled
+    segment_id_t* _twin_next = NULL;    // for each active segment, the next active segment that may be identical to it
+
+    frame_cache* _caches = NULL;        // array of segment frame caches, allocated when the first frame cache is set
+
+    const show_cue* _cues = NULL;       // cue list, not copied
+    uint8_t  _num_cues = 0;             // number of cues in the cue list
+    uint8_t  _cue = NO_CUE;             // the cue that's running
+    uint8_t  _next_cue = NO_CUE;        // the cue to switch to at the next frame
+    bool     _cue_loop = false;         // true to start over after the last cue
+    uint32_t _cue_cycles = 0;           // number of cycles the running cue has been through
+    unsigned long _cue_time = 0;        // time the running cue started
+
+    const led_position* _positions = NULL; // LED positions, not copied
+    uint16_t _num_positions = 0;        // number of LED positions
+    uint16_t* _bucket_starts = NULL;    // spatial index, the first entry in _bucket_leds of each bucket
+    uint16_t* _bucket_leds = NULL;      // spatial index, the LEDs sorted by bucket
+    led_position _spatial_dir = {0, 127, 0}; // direction of the spatial sweep and wipe effects
+
+    segment_id_t activeSlot(segment_id_t);
+    void setActiveSlot(segment_id_t, segment_id_t);
+    uint16_t renderShadow(segment*, segment_runtime*, uint8_t*, pixel_index_t);
+    uint16_t runMode(void);
+    uint8_t segmentScale(segment_id_t);
+    void captureKeyframe(segment_id_t);
+    const uint8_t* interpolateKeyframe(segment_id_t, const uint8_t*, pixel_index_t, pixel_index_t*);
+    bool isTwin(segment_id_t, segment_id_t);
+    void chainTwins(unsigned long now, segment_id_t first);
+    void dedupeSegment(segment_id_t, const segment_runtime*, unsigned long);
+    uint16_t runCached(segment_id_t);
+    void recordFrame(frame_cache*, uint16_t);
+    uint16_t replayFrame(frame_cache*);
+    void unrollRing(segment_id_t, segment_runtime*);
+    bool serviceLayers(unsigned long);
+    bool serviceTransitions(unsigned long);
+    bool initTransitions(void);
+    void serviceCues(unsigned long);
+    void switchCue(uint8_t, unsigned long);
+    void autoTransition(segment_id_t);
+    void showOutputs(void);
+    void remapOutput(const uint8_t*, uint8_t*);
+    void encodeMatrices(uint8_t*);
+    int16_t spatialDepth(pixel_index_t);
+    void initOutput(void);
+    void initPower(void);
+    void updatePowerBudget(void);
+    void updateThermalModel(uint32_t);
+    bool encodeOutput(void);
+    uint8_t* allocBuffer(size_t, uint8_t);
+    void moveBuffer(uint8_t**, size_t, uint8_t);
+    void placeBuffers(void);
+    uint8_t* stageBuffer(size_t);
+    void stagePixels(size_t);
+#if PIXEL_INDEX_BITS == 32
+    void syncLength(void);
+#endif
 };
 
 class WS2812FXT {
   public:
-    WS2812FXT(uint16_t num_leds, uint8_t pin, neoPixelType type,
-      uint8_t max_num_segments=MAX_NUM_SEGMENTS,
-      uint8_t max_num_active_segments=MAX_NUM_ACTIVE_SEGMENTS) {
+    WS2812FXT(pixel_index_t num_leds, uint8_t pin, neoPixelType type,
+      segment_id_t max_num_segments=MAX_NUM_SEGMENTS,
+      segment_id_t max_num_active_segments=MAX_NUM_ACTIVE_SEGMENTS) {
         v1 = new WS2812FX(num_leds, pin, type, max_num_segments, max_num_active_segments);
         v2 = new WS2812FX(num_leds, pin, type, max_num_segments, max_num_active_segments);
         dest = new WS2812FX(num_leds, pin, type, max_num_segments, max_num_active_segments); 
@@ -798,7 +1270,7 @@ class WS2812FXT {
       uint8_t *dest_p = dest->getPixels();
       uint8_t *vstart_p = transitionDirection ? v1->getPixels() : v2->getPixels();
       uint8_t *vstop_p  = transitionDirection ? v2->getPixels() : v1->getPixels();
-      uint16_t numBytes = dest->getNumBytes();
+      pixel_index_t numBytes = dest->getNumBytes();
 
       if(now < transitionStartTime) {
         memmove(dest_p, vstart_p, numBytes);
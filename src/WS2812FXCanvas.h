@@ -0,0 +1,137 @@
+/*
+  WS2812FXCanvas.h - Adafruit_GFX drawing target for WS2812FX matrix segments
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#ifndef WS2812FXCanvas_h
+#define WS2812FXCanvas_h
+
+#include <Adafruit_GFX.h>
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // matrices are not supported on ATtiny devices
+
+/*
+ * An Adafruit_GFX canvas that draws text and shapes straight into the pixel
+ * data of the segment an effect is running on, using the segment's matrix
+ * layout (see setMatrix()). There's no second pixel buffer and no second
+ * show(): use the canvas in a custom effect, and the drawing is shown like any
+ * other effect. Run the custom effect as a layer to draw over another effect.
+ *
+ * Adafruit_GFX uses 16-bit (RGB565) colors, use Color() to make them.
+ */
+class WS2812FXCanvas : public Adafruit_GFX {
+
+  public:
+    WS2812FXCanvas(WS2812FX& strip, int16_t width, int16_t height)
+      : Adafruit_GFX(width, height), _strip(strip) {
+    };
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      switch(rotation) {
+        case 1: { int16_t t = x; x = WIDTH - 1 - y; y = t; break; }
+        case 2: x = WIDTH - 1 - x; y = HEIGHT - 1 - y; break;
+        case 3: { int16_t t = x; x = y; y = HEIGHT - 1 - t; break; }
+      }
+      if(x < 0 || y < 0 || x >= rawWidth() || y >= rawHeight()) return;
+      _strip.setPixelColor(_strip.XY(x, y), expandColor(color));
+    };
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      fillRect(x, y, w, 1, color);
+    };
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      fillRect(x, y, 1, h, color);
+    };
+
+    void fillScreen(uint16_t color) {
+      fillRect(0, 0, _width, _height, color);
+    };
+
+    /*
+     * Fill a rectangle a row at a time. Only the first pixel's color is
+     * converted, the rest of the rectangle is copied from it.
+     */
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      // convert the rectangle to unrotated coordinates
+      switch(rotation) {
+        case 1: { int16_t t = x; x = WIDTH - y - h; y = t; t = w; w = h; h = t; break; }
+        case 2: x = WIDTH - x - w; y = HEIGHT - y - h; break;
+        case 3: { int16_t t = x; x = y; y = HEIGHT - t - w; t = w; w = h; h = t; break; }
+      }
+
+      // clip the rectangle to the matrix
+      if(x < 0) { w += x; x = 0; }
+      if(y < 0) { h += y; y = 0; }
+      if(x + w > rawWidth())  w = rawWidth() - x;
+      if(y + h > rawHeight()) h = rawHeight() - y;
+      if(w <= 0 || h <= 0) return;
+
+      uint8_t bytesPerPixel = _strip.getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+      pixel_index_t first = _strip.XY(x, y);
+      _strip.setPixelColor(first, expandColor(color));
+
+      uint8_t* row = _strip.getPixels() + first * bytesPerPixel;
+      for(int16_t i=1; i < w; i++) {
+        memcpy(row + i * bytesPerPixel, row, bytesPerPixel);
+      }
+      for(int16_t j=1; j < h; j++) {
+        memcpy(_strip.getPixels() + _strip.XY(x, y + j) * bytesPerPixel, row, w * bytesPerPixel);
+      }
+    };
+
+    // make a 16-bit (RGB565) color from 8-bit red, green and blue values
+    static uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+    };
+
+  private:
+    WS2812FX& _strip;
+
+    // the canvas is clipped to the matrix of the segment being drawn
+    int16_t rawWidth(void) {
+      return WIDTH < (int16_t)_strip.getMatrixWidth() ? WIDTH : _strip.getMatrixWidth();
+    };
+
+    int16_t rawHeight(void) {
+      return HEIGHT < (int16_t)_strip.getMatrixHeight() ? HEIGHT : _strip.getMatrixHeight();
+    };
+
+    // convert a 16-bit (RGB565) color to a 24-bit color
+    static uint32_t expandColor(uint16_t c) {
+      uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+      return ((uint32_t)((r << 3) | (r >> 2)) << 16) | ((uint32_t)((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    };
+};
+
+#endif
+#endif
@@ -0,0 +1,121 @@
+/*
+  WS2812FXClip.h - streaming animation clip player for WS2812FX
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#ifndef WS2812FXClip_h
+#define WS2812FXClip_h
+
+#include "WS2812FX.h"
+#include "clip_codec.h"
+
+#if !defined(MEGATINYCORE) // clips are not supported on ATtiny devices
+
+#ifndef CLIP_BLOCK_SIZE
+  #define CLIP_BLOCK_SIZE 256 // size of each of a clip player's two read buffers
+#endif
+
+/*
+ * Plays a clip (see clip_codec.h) with the Clip effect. The clip is read in
+ * CLIP_BLOCK_SIZE blocks, and never held in RAM, so clips can be any length.
+ * While one block is being decoded, the next block is already loaded, and
+ * the block after that is read as soon as the frame has been decoded, so
+ * the reads happen while the frame is being shown, not when the next frame
+ * is due. Clips loop back to their first frame when they end.
+ * Subclasses read the clip from where it's stored.
+ */
+class WS2812FXClip {
+  public:
+    virtual ~WS2812FXClip(void) { free(_palette); }
+
+    uint16_t getNumLEDs(void) { return _header.numLEDs; }
+    uint32_t getNumFrames(void) { return _header.numFrames; }
+    uint32_t getFrame(void) { return _frame; }
+
+    void rewind(void);
+    uint16_t nextFrame(WS2812FX*, pixel_index_t, pixel_index_t);
+
+  protected:
+    bool open(void);
+    // reads up to len bytes from position pos, returns the number of bytes read
+    virtual size_t readClip(uint32_t pos, uint8_t* buf, size_t len) = 0;
+
+  private:
+    static void putPixel(void*, uint32_t, uint32_t);
+    bool ready(void);
+    bool fill(uint8_t);
+
+    clip_header _header = {};
+    clip_decoder _decoder = {};
+    uint8_t* _palette = NULL;
+    uint32_t _framesStart = 0;  // position of the first frame
+    uint32_t _readPos = 0;      // position of the next block to read
+    uint32_t _frame = 0;        // the next frame to play
+    uint8_t _blocks[2][CLIP_BLOCK_SIZE];
+    uint16_t _blockLen[2] = {0, 0};
+    uint8_t _block = 0;         // the block being decoded
+    uint16_t _pos = 0;          // position in the block being decoded
+    WS2812FX* _fx = NULL;       // the LEDs the frame is being decoded to
+    pixel_index_t _first = 0;
+    pixel_index_t _len = 0;
+};
+
+#if __has_include(<FS.h>)
+#include <FS.h>
+
+/*
+ * Plays a clip from a LittleFS, SPIFFS or SD file, e.g.
+ *   WS2812FXFileClip clip;
+ *   clip.begin(LittleFS.open("/show.wfx", "r"));
+ *   ws2812fx.setSegment(0, 0, LED_COUNT-1, FX_MODE_CLIP);
+ *   ws2812fx.setExtDataSrc(0, (uint8_t*)&clip, 1);
+ */
+class WS2812FXFileClip : public WS2812FXClip {
+  public:
+    // returns false if the file isn't a clip
+    bool begin(fs::File file) {
+      _file = file;
+      return open();
+    }
+
+  protected:
+    size_t readClip(uint32_t pos, uint8_t* buf, size_t len) {
+      if(!_file || (_file.position() != pos && !_file.seek(pos))) return 0;
+      return _file.read(buf, len);
+    }
+
+  private:
+    fs::File _file;
+};
+#endif
+
+#endif
+#endif
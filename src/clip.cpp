@@ -0,0 +1,168 @@
+/*
+  clip.cpp - WS2812FX clip player functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FXClip.h"
+
+#if !defined(MEGATINYCORE) // clips are not supported on ATtiny devices
+
+/*
+ * Reads the clip's header and palette, and loads the first frames.
+ * Returns false if the clip can't be read, or isn't a clip.
+ */
+bool WS2812FXClip::open(void) {
+  uint8_t buf[CLIP_HEADER_SIZE];
+  free(_palette);
+  _palette = NULL;
+  if(readClip(0, buf, CLIP_HEADER_SIZE) != CLIP_HEADER_SIZE || !clipReadHeader(buf, &_header)) {
+    _header.numFrames = 0;
+    return false;
+  }
+
+  _framesStart = CLIP_HEADER_SIZE;
+  if(_header.flags & CLIP_PALETTE) {
+    uint16_t size = _header.paletteSize * _header.bytesPerPixel;
+    _palette = (uint8_t*)malloc(size);
+    if(_palette == NULL || readClip(_framesStart, _palette, size) != size) {
+      free(_palette);
+      _palette = NULL;
+      _header.numFrames = 0;
+      return false;
+    }
+    _framesStart += size;
+  }
+
+  clipBeginDecode(&_decoder, &_header, _palette, putPixel, this);
+  rewind();
+  return true;
+}
+
+// go back to the clip's first frame
+void WS2812FXClip::rewind(void) {
+  _readPos = _framesStart;
+  _frame = 0;
+  _block = 0;
+  _pos = 0;
+  _blockLen[0] = _blockLen[1] = 0;
+  if(fill(0)) fill(1);
+}
+
+/*
+ * Decodes the next frame to the LEDs starting at LED first. The frame's LEDs
+ * past len LEDs are ignored, and LEDs past the clip's (at most 65535) LEDs are
+ * left alone. Returns the frame's delay, or 0 if the frame has
+ * no delay or the clip couldn't be read.
+ */
+uint16_t WS2812FXClip::nextFrame(WS2812FX* fx, pixel_index_t first, pixel_index_t len) {
+  if(_header.numFrames == 0) return 0;
+
+  uint8_t buf[CLIP_FRAME_HEADER_SIZE];
+  clip_frame frame;
+  for(uint8_t i=0; i < CLIP_FRAME_HEADER_SIZE; i++) {
+    if(!ready()) return 0;
+    buf[i] = _blocks[_block][_pos++];
+  }
+  clipReadFrame(buf, &frame);
+
+  _fx = fx;
+  _first = first;
+  _len = len;
+  clipBeginFrame(&_decoder);
+  while(frame.size > 0) {
+    if(!ready()) { // the clip is damaged, start over
+      rewind();
+      return 0;
+    }
+    uint16_t n = _blockLen[_block] - _pos;
+    if(n > frame.size) n = frame.size;
+    clipDecode(&_decoder, _blocks[_block] + _pos, n);
+    _pos += n;
+    frame.size -= n;
+  }
+  _frame = (_frame + 1) % _header.numFrames;
+
+  // read ahead, so the next frame is in RAM when it's due
+  if(_pos == _blockLen[_block]) ready();
+  if(_blockLen[_block ^ 1] == 0) fill(_block ^ 1);
+  return frame.delay;
+}
+
+// makes sure the block being decoded has bytes left, moving on to the next block when it hasn't
+bool WS2812FXClip::ready(void) {
+  if(_pos < _blockLen[_block]) return true;
+  _blockLen[_block] = 0;
+  _block ^= 1;
+  _pos = 0;
+  return _blockLen[_block] > 0 || fill(_block);
+}
+
+// reads the next block, wrapping around to the first frame at the end of the clip
+bool WS2812FXClip::fill(uint8_t block) {
+  uint16_t len = 0;
+  while(len < CLIP_BLOCK_SIZE) {
+    size_t n = readClip(_readPos, _blocks[block] + len, CLIP_BLOCK_SIZE - len);
+    if(n == 0) {
+      if(_readPos == _framesStart) break; // the clip can't be read
+      _readPos = _framesStart;
+      continue;
+    }
+    len += n;
+    _readPos += n;
+  }
+  _blockLen[block] = len;
+  return len > 0;
+}
+
+void WS2812FXClip::putPixel(void* ctx, uint32_t n, uint32_t color) {
+  WS2812FXClip* clip = (WS2812FXClip*)ctx;
+  if(n < clip->_len) clip->_fx->setPixelColor(clip->_first + n, color);
+}
+
+/*
+ * Plays a WS2812FXClip, which is passed to the effect with setExtDataSrc().
+ * Frames that have no delay are shown for the segment's speed.
+ * Note, a clip can only be played by one segment at a time.
+ */
+uint16_t WS2812FX::mode_clip(void) {
+  // An external data source is required for the clip effect, so bale if none has been setup
+  if(_seg_rt->extDataSrc == NULL) return _seg->speed;
+  WS2812FXClip* clip = (WS2812FXClip*)_seg_rt->extDataSrc;
+
+  // start at the first frame, which is a keyframe, if the clip isn't where the effect left it
+  if(_seg_rt->counter_mode_call == 0 || clip->getFrame() != _seg_rt->counter_mode_step) clip->rewind();
+
+  uint16_t delay = clip->nextFrame(this, _seg->start, _seg_len);
+  _seg_rt->counter_mode_step = clip->getFrame();
+  if(_seg_rt->counter_mode_step == 0) SET_CYCLE;
+  return delay ? delay : _seg->speed;
+}
+
+#endif
@@ -0,0 +1,286 @@
+/*
+  clip_codec.h - WS2812FX animation clip format
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+
+#ifndef clip_codec_h
+#define clip_codec_h
+
+// the clip codec has no Arduino dependencies, so host tools can use it too
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * A clip is a header, an optional palette and a sequence of frames. Numbers
+ * are little-endian.
+ *
+ *   header   "WFXC", version, flags, bytes per pixel, 0,
+ *            number of LEDs (2 bytes), number of frames (4 bytes),
+ *            number of palette colors (2 bytes)
+ *   palette  the palette colors, bytes per pixel bytes each (R, G, B[, W])
+ *   frame    type, delay in ms (2 bytes), payload size (4 bytes), payload
+ *
+ * A frame's payload is a list of ops, which set the frame's pixels in order.
+ * Each op is one byte: the top two bits are the op, the low six bits are the
+ * number of pixels minus one.
+ *   CLIP_OP_SKIP     the pixels are the same as in the previous frame
+ *   CLIP_OP_LITERAL  a color follows for each pixel
+ *   CLIP_OP_REPEAT   one color follows, which is used for all the pixels
+ * A color is a one byte palette index if the clip has a palette, otherwise
+ * it's bytes per pixel bytes (R, G, B[, W]).
+ * Keyframes don't use SKIP ops, so they don't depend on the previous frame.
+ * The first frame is always a keyframe. A clip has at most 65535 LEDs.
+ */
+#define CLIP_MAGIC             "WFXC"
+#define CLIP_VERSION           1
+#define CLIP_HEADER_SIZE       16
+#define CLIP_FRAME_HEADER_SIZE 7
+
+// clip flags
+#define CLIP_PALETTE (uint8_t)0x01
+
+// frame types
+#define CLIP_KEYFRAME 0
+#define CLIP_DELTA    1
+
+// payload ops
+#define CLIP_OP_SKIP    (uint8_t)0x00
+#define CLIP_OP_LITERAL (uint8_t)0x40
+#define CLIP_OP_REPEAT  (uint8_t)0x80
+#define CLIP_OP_MASK    (uint8_t)0xc0
+#define CLIP_MAX_RUN    64
+
+struct clip_header {
+  uint8_t  flags;
+  uint8_t  bytesPerPixel; // 3=RGB, 4=RGBW
+  uint16_t numLEDs;
+  uint32_t numFrames;
+  uint16_t paletteSize;   // number of palette colors
+};
+
+struct clip_frame {
+  uint8_t  type;
+  uint16_t delay;         // ms to show the frame for
+  uint32_t size;          // payload size
+};
+
+/*
+ * Called by the decoder for each pixel set by a frame, color is 0xWWRRGGBB.
+ * If the clip has a palette, but the decoder wasn't given it, color is the
+ * palette index instead, so the palette can be kept elsewhere (e.g. PROGMEM).
+ */
+typedef void (*clip_pixel_cb)(void* ctx, uint32_t n, uint32_t color);
+
+struct clip_decoder {
+  const uint8_t* palette; // palette colors, or NULL
+  uint8_t  bytesPerPixel;
+  uint8_t  colorSize;     // 1 for palette indexes, otherwise bytesPerPixel
+  uint16_t numLEDs;
+  clip_pixel_cb put;
+  void*    ctx;
+  uint32_t pixel;         // next pixel to set, 32-bit so ops past the last LED can't wrap it
+  uint8_t  op;            // current op
+  uint8_t  count;         // pixels left in the current op
+  uint8_t  have;          // number of bytes of the current color read so far
+  uint8_t  value[4];      // the current color
+};
+
+static inline uint16_t clipRead16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t clipRead32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void clipWrite16(uint8_t* p, uint16_t v) {
+  p[0] = v; p[1] = v >> 8;
+}
+
+static inline void clipWrite32(uint8_t* p, uint32_t v) {
+  p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+// returns false if buf doesn't hold a clip header this decoder understands
+static inline bool clipReadHeader(const uint8_t* buf, clip_header* h) {
+  if(memcmp(buf, CLIP_MAGIC, 4) != 0 || buf[4] != CLIP_VERSION) return false;
+  h->flags = buf[5];
+  h->bytesPerPixel = buf[6];
+  h->numLEDs = clipRead16(buf + 8);
+  h->numFrames = clipRead32(buf + 10);
+  h->paletteSize = clipRead16(buf + 14);
+  if(h->bytesPerPixel != 3 && h->bytesPerPixel != 4) return false;
+  if((h->flags & CLIP_PALETTE) && (h->paletteSize == 0 || h->paletteSize > 256)) return false;
+  return h->numFrames > 0;
+}
+
+static inline void clipWriteHeader(uint8_t* buf, const clip_header* h) {
+  memcpy(buf, CLIP_MAGIC, 4);
+  buf[4] = CLIP_VERSION;
+  buf[5] = h->flags;
+  buf[6] = h->bytesPerPixel;
+  buf[7] = 0;
+  clipWrite16(buf + 8, h->numLEDs);
+  clipWrite32(buf + 10, h->numFrames);
+  clipWrite16(buf + 14, h->flags & CLIP_PALETTE ? h->paletteSize : 0);
+}
+
+static inline void clipReadFrame(const uint8_t* buf, clip_frame* f) {
+  f->type = buf[0];
+  f->delay = clipRead16(buf + 1);
+  f->size = clipRead32(buf + 3);
+}
+
+static inline void clipWriteFrame(uint8_t* buf, const clip_frame* f) {
+  buf[0] = f->type;
+  clipWrite16(buf + 1, f->delay);
+  clipWrite32(buf + 3, f->size);
+}
+
+// returns the color stored in a clip's R, G, B[, W] bytes as 0xWWRRGGBB
+static inline uint32_t clipColor(const uint8_t* p, uint8_t bytesPerPixel) {
+  uint32_t color = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+  return bytesPerPixel == 4 ? color | ((uint32_t)p[3] << 24) : color;
+}
+
+static inline void clipBeginDecode(clip_decoder* d, const clip_header* h, const uint8_t* palette, clip_pixel_cb put, void* ctx) {
+  d->palette = (h->flags & CLIP_PALETTE) ? palette : NULL;
+  d->bytesPerPixel = h->bytesPerPixel;
+  d->colorSize = (h->flags & CLIP_PALETTE) ? 1 : h->bytesPerPixel;
+  d->numLEDs = h->numLEDs;
+  d->put = put;
+  d->ctx = ctx;
+  d->pixel = 0;
+  d->count = 0;
+}
+
+// starts decoding a frame's payload
+static inline void clipBeginFrame(clip_decoder* d) {
+  d->pixel = 0;
+  d->count = 0;
+}
+
+/*
+ * Decodes the next len bytes of a frame's payload. A payload can be split
+ * into any number of pieces, so it can be decoded as it's read.
+ */
+static inline void clipDecode(clip_decoder* d, const uint8_t* data, uint32_t len) {
+  while(len--) {
+    uint8_t b = *data++;
+    if(d->count == 0) { // start a new op
+      d->op = b & CLIP_OP_MASK;
+      d->count = (b & ~CLIP_OP_MASK) + 1;
+      d->have = 0;
+      if(d->op == CLIP_OP_SKIP) {
+        d->pixel += d->count;
+        d->count = 0;
+      }
+      continue;
+    }
+
+    d->value[d->have++] = b;
+    if(d->have < d->colorSize) continue;
+    d->have = 0;
+
+    uint32_t color = d->colorSize > 1 ? clipColor(d->value, d->bytesPerPixel) :
+                     d->palette ? clipColor(d->palette + d->value[0] * d->bytesPerPixel, d->bytesPerPixel) :
+                     d->value[0];
+    uint8_t n = d->op == CLIP_OP_REPEAT ? d->count : 1;
+    for(uint8_t i=0; i < n; i++) {
+      if(d->pixel < d->numLEDs) d->put(d->ctx, d->pixel, color);
+      d->pixel++;
+    }
+    d->count -= n;
+  }
+}
+
+// returns the number of pixels, starting at pixel n, that are the same color as pixel n
+static inline uint16_t clipRepeats(const uint8_t* frame, uint16_t n, uint16_t numLEDs, uint8_t colorSize) {
+  uint16_t run = 1;
+  while(n + run < numLEDs && run < CLIP_MAX_RUN &&
+    memcmp(frame + (n + run) * colorSize, frame + n * colorSize, colorSize) == 0) run++;
+  return run;
+}
+
+// returns the largest payload clipEncode() can produce
+static inline uint32_t clipMaxPayload(uint16_t numLEDs, uint8_t colorSize) {
+  return (uint32_t)numLEDs * (colorSize + 1);
+}
+
+/*
+ * Encodes a frame's pixels, colorSize bytes each (one byte palette indexes,
+ * or the colors' bytes), as a keyframe if prev is NULL, or else as the changes
+ * from prev. Writes the payload to out, and returns its size.
+ */
+static inline uint32_t clipEncode(const uint8_t* frame, const uint8_t* prev, uint16_t numLEDs, uint8_t colorSize, uint8_t* out) {
+  uint8_t minRepeat = colorSize == 1 ? 3 : 2; // shorter repeats are no smaller than literals
+  uint8_t* p = out;
+  uint16_t n = 0;
+  while(n < numLEDs) {
+    const uint8_t* pixel = frame + n * colorSize;
+
+    // unchanged pixels
+    uint16_t run = 0;
+    while(prev && n + run < numLEDs && run < CLIP_MAX_RUN &&
+      memcmp(frame + (n + run) * colorSize, prev + (n + run) * colorSize, colorSize) == 0) run++;
+    if(run > 0) {
+      *p++ = CLIP_OP_SKIP | (run - 1);
+      n += run;
+      continue;
+    }
+
+    // repeated pixels
+    run = clipRepeats(frame, n, numLEDs, colorSize);
+    if(run >= minRepeat) {
+      *p++ = CLIP_OP_REPEAT | (run - 1);
+      memcpy(p, pixel, colorSize);
+      p += colorSize;
+      n += run;
+      continue;
+    }
+
+    // literal pixels, up to the next unchanged or repeated pixel
+    run = 1;
+    while(n + run < numLEDs && run < CLIP_MAX_RUN) {
+      uint16_t next = n + run;
+      if(prev && memcmp(frame + next * colorSize, prev + next * colorSize, colorSize) == 0) break;
+      if(clipRepeats(frame, next, numLEDs, colorSize) >= minRepeat) break;
+      run++;
+    }
+    *p++ = CLIP_OP_LITERAL | (run - 1);
+    memcpy(p, pixel, run * colorSize);
+    p += run * colorSize;
+    n += run;
+  }
+  return p - out;
+}
+
+#endif
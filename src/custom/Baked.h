@@ -0,0 +1,116 @@
+/*
+  Custom effect that plays an effect baked into a PROGMEM array by the
+  wfxbake tool (extras/tools/wfxbake.cpp). The baked frames are decoded
+  straight from flash memory, so the effect uses the same small amount of
+  RAM and CPU time whichever effect was baked, which lets boards show effects
+  they don't have, or don't have the time to run (like TwinkleFOX or Popcorn
+  on an ATtiny). Pass the array to the effect with setExtDataSrc():
+
+    #include "tfox.h" // made with: wfxbake -p TwinkleFOX 30 tfox > tfox.h
+    ws2812fx.setCustomMode(baked);
+    ws2812fx.setSegment(0, 0, 29, FX_MODE_CUSTOM_0, BLACK, 1000, NO_OPTIONS);
+    ws2812fx.setExtDataSrc(0, (uint8_t*)tfox, 1);
+
+  Baked clips have a frame delay for each frame, so the segment's speed, and
+  colors, aren't used. Clips of up to 65535 frames can be played.
+
+  LICENSE
+  The MIT License (MIT)
+  Copyright (c) 2026  Keith Lord 
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sub-license, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+  CHANGELOG
+  2026-10-19 initial version
+*/
+
+#ifndef Baked_h
+#define Baked_h
+
+#include <WS2812FX.h>
+#include <clip_codec.h>
+
+extern WS2812FX ws2812fx;
+
+typedef struct Baked_leds {
+  const uint8_t* palette; // the clip's palette, in PROGMEM
+  uint8_t bytesPerPixel;
+  pixel_index_t first; // the segment's first LED
+  uint16_t len;
+} baked_leds;
+
+void bakedPixel(void* ctx, uint32_t n, uint32_t color) {
+  baked_leds* leds = (baked_leds*)ctx;
+  if(n >= leds->len) return;
+  if(leds->palette != NULL) { // color is a palette index
+    uint8_t rgbw[4];
+    memcpy_P(rgbw, leds->palette + color * leds->bytesPerPixel, leds->bytesPerPixel);
+    color = clipColor(rgbw, leds->bytesPerPixel);
+  }
+  ws2812fx.setPixelColor(leds->first + n, color);
+}
+
+uint16_t baked(void) {
+  WS2812FX::Segment* seg = ws2812fx.getSegment();
+  WS2812FX::Segment_runtime* segrt = ws2812fx.getSegmentRuntime();
+  const uint8_t* clip = segrt->extDataSrc;
+  if(clip == NULL) return seg->speed;
+
+  uint8_t buf[16]; // the clip is copied out of PROGMEM 16 bytes at a time
+  clip_header header;
+  memcpy_P(buf, clip, CLIP_HEADER_SIZE);
+  if(!clipReadHeader(buf, &header)) return seg->speed;
+
+  baked_leds leds = { NULL, header.bytesPerPixel, seg->start, (uint16_t)(seg->stop - seg->start + 1) };
+  uint32_t framesStart = CLIP_HEADER_SIZE;
+  if(header.flags & CLIP_PALETTE) {
+    leds.palette = clip + CLIP_HEADER_SIZE;
+    framesStart += header.paletteSize * header.bytesPerPixel;
+  }
+
+  // counter_mode_step is where the next frame starts, aux_param3 is its number
+  if(segrt->counter_mode_call == 0 || segrt->aux_param3 >= header.numFrames) {
+    segrt->counter_mode_step = framesStart;
+    segrt->aux_param3 = 0;
+  }
+
+  clip_frame frame;
+  uint32_t pos = segrt->counter_mode_step;
+  memcpy_P(buf, clip + pos, CLIP_FRAME_HEADER_SIZE);
+  clipReadFrame(buf, &frame);
+  pos += CLIP_FRAME_HEADER_SIZE;
+
+  clip_decoder decoder;
+  clipBeginDecode(&decoder, &header, NULL, bakedPixel, &leds); // palette indexes are looked up by bakedPixel()
+  while(frame.size > 0) {
+    uint8_t n = frame.size < sizeof(buf) ? frame.size : sizeof(buf);
+    memcpy_P(buf, clip + pos, n);
+    clipDecode(&decoder, buf, n);
+    pos += n;
+    frame.size -= n;
+  }
+
+  segrt->counter_mode_step = pos;
+  segrt->aux_param3++;
+  if(segrt->aux_param3 >= header.numFrames) {
+    segrt->counter_mode_step = framesStart;
+    segrt->aux_param3 = 0;
+    ws2812fx.setCycle();
+  }
+  return frame.delay ? frame.delay : seg->speed;
+}
+
+#endif
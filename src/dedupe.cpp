@@ -0,0 +1,185 @@
+/*
+  dedupe.cpp - WS2812FX segment deduplication functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // dedupe is not supported on ATtiny devices
+
+/*
+ * Segments that run the same mode, with the same colors, speed, options and
+ * length, and whose effects are at exactly the same point (e.g. they were set
+ * up at the same time), always render the same pixels. With dedupe enabled,
+ * service() only renders the first of a group of identical segments, and
+ * copies its pixel data (reversed, if only the REVERSE option differs) and
+ * runtime to the others. A segment leaves its group as soon as its settings
+ * or runtime differ, and joins a group when they match again.
+ * Note, segments copied from another segment also copy its random numbers,
+ * so random effects look the same on all the segments in a group.
+ */
+void WS2812FX::setDedupe(bool enable) {
+  if(enable && _twins == NULL) {
+    _twins = (segment_id_t *)malloc(_active_segments_len * sizeof(segment_id_t));
+    _twin_next = (segment_id_t *)malloc(_active_segments_len * sizeof(segment_id_t));
+    if(_twins != NULL) memset(_twins, 0xFF, _active_segments_len * sizeof(segment_id_t)); // all INACTIVE_SEGMENT
+    _chain_twins = &WS2812FX::chainTwins;
+    _dedupe_segment = &WS2812FX::dedupeSegment;
+  }
+  if(!enable || _twins == NULL || _twin_next == NULL) {
+    free(_twins);
+    _twins = NULL;
+    free(_twin_next);
+    _twin_next = NULL;
+  }
+}
+
+// returns true if the segment was copied from an identical segment the last time service() ran any segments
+bool WS2812FX::isDeduped(segment_id_t seg) {
+  if(_twins == NULL) return false;
+  segment_id_t slot = activeSlot(seg);
+  return slot != INACTIVE_SEGMENT && _twins[slot] != INACTIVE_SEGMENT;
+}
+
+// returns true if segments a and b render the same pixels, given the same runtime
+bool WS2812FX::isTwin(segment_id_t a, segment_id_t b) {
+  segment* sa = &_segments[a];
+  segment* sb = &_segments[b];
+  if(sa->mode != sb->mode || sa->speed != sb->speed) return false;
+  if(sa->stop - sa->start != sb->stop - sb->start || sa->stop >= numLEDs || sb->stop >= numLEDs) return false;
+  if(memcmp(sa->colors, sb->colors, sizeof(sa->colors)) != 0) return false;
+
+  // spatial effects depend on where the segment's LEDs are, and keyframes on when the effect ran
+  if(_positions != NULL) return false;
+  if(_keyframes != NULL && (_keyframes[a].interval || _keyframes[b].interval)) return false;
+  if(segmentScale(a) != segmentScale(b)) return false;
+
+  // matrix segments must be the same shape, and can't be reversed copies of each other
+  uint8_t options = sa->options ^ sb->options;
+  if(_matrices != NULL && (_matrices[a].width || _matrices[b].width)) {
+    if(_matrices[a].width != _matrices[b].width || _matrices[a].height != _matrices[b].height) return false;
+    return options == 0;
+  }
+  return (options & ~REVERSE) == 0;
+}
+
+// returns true if two runtimes are at the same point, ignoring the frame and cycle flags
+static bool isSameRuntime(const WS2812FX::segment_runtime* a, const WS2812FX::segment_runtime* b) {
+  return a->counter_mode_step == b->counter_mode_step &&
+    a->counter_mode_call == b->counter_mode_call &&
+    a->aux_param == b->aux_param &&
+    ((a->aux_param2 ^ b->aux_param2) & ~(FRAME | CYCLE)) == 0 &&
+    a->aux_param3 == b->aux_param3 &&
+    a->extDataSrc == b->extDataSrc &&
+    a->extDataCnt == b->extDataCnt &&
+    a->head == b->head;
+}
+
+// mix a value into a hash (FNV-1a, a word at a time)
+static inline uint32_t hashMix(uint32_t h, uint32_t v) {
+  return (h ^ v) * 16777619UL;
+}
+
+// a hash of everything isTwin() and isSameRuntime() compare, and the next time, so twins always have the same hash
+static uint32_t twinHash(const WS2812FX::segment* s, uint8_t scale, const WS2812FX::segment_runtime* rt, unsigned long nextTime) {
+  uint32_t h = 2166136261UL;
+  h = hashMix(h, s->mode | ((uint32_t)(s->options & ~REVERSE) << 8) | ((uint32_t)scale << 16));
+  h = hashMix(h, s->speed);
+  h = hashMix(h, s->stop - s->start);
+  for(uint8_t i=0; i < MAX_NUM_COLORS; i++) h = hashMix(h, s->colors[i]);
+  h = hashMix(h, nextTime);
+  h = hashMix(h, rt->counter_mode_step);
+  h = hashMix(h, rt->counter_mode_call);
+  h = hashMix(h, rt->aux_param | ((uint32_t)(rt->aux_param2 & ~(FRAME | CYCLE)) << 8) | ((uint32_t)rt->extDataCnt << 16));
+  h = hashMix(h, rt->aux_param3);
+  h = hashMix(h, (uint32_t)(uintptr_t)rt->extDataSrc);
+  return hashMix(h, rt->head);
+}
+
+/*
+ * Chain together the active segments that may be identical, before any of
+ * them are rendered, so dedupeSegment() only compares a segment with the ones
+ * that hash the same, instead of with every active segment after it. Each
+ * chain runs in slot order. _twins is borrowed as the hash table's bucket
+ * heads while the chains are built.
+ * service() calls this when it finds the first due segment, so it costs
+ * nothing while no segment is due. Identical segments have the same next_time,
+ * so only the due segments from that slot on are chained.
+ */
+void WS2812FX::chainTwins(unsigned long now, segment_id_t first) {
+  memset(_twins, 0xFF, _active_segments_len * sizeof(segment_id_t)); // all INACTIVE_SEGMENT
+  for(segment_id_t k=_active_segments_len; k-- > first;) {
+    segment_id_t seg = _active_segments[k];
+    _twin_next[k] = INACTIVE_SEGMENT;
+    if(seg == INACTIVE_SEGMENT || !(now > _next_times[k] || _triggered)) continue;
+    segment_id_t bucket = twinHash(&_segments[seg], segmentScale(seg), &_segment_runtimes[k], _next_times[k]) % _active_segments_len;
+    _twin_next[k] = _twins[bucket];
+    _twins[bucket] = k;
+  }
+  memset(_twins, 0xFF, _active_segments_len * sizeof(segment_id_t)); // all INACTIVE_SEGMENT
+}
+
+/*
+ * Copy the active segment that was just rendered to the active segments after
+ * it that are identical to it, and whose runtime and next time matched its
+ * runtime and next time before it was rendered. Only the segments chained to
+ * it by chainTwins() can match.
+ */
+void WS2812FX::dedupeSegment(segment_id_t slot, const segment_runtime* before, unsigned long beforeTime) {
+  segment_id_t seg = _active_segments[slot];
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(segment_id_t k=_twin_next[slot]; k != INACTIVE_SEGMENT; k = _twin_next[k]) {
+    segment_id_t twin = _active_segments[k];
+    if(_twins[k] != INACTIVE_SEGMENT) continue;
+    if(!isTwin(seg, twin) || _next_times[k] != beforeTime || !isSameRuntime(&_segment_runtimes[k], before)) continue;
+
+    // copy the rendered pixels, the effect only rendered len/scale pixels
+    uint8_t scale = segmentScale(seg);
+    pixel_index_t len = (_segments[seg].stop - _segments[seg].start + scale) / scale;
+    uint8_t* src = pixels + _segments[seg].start * bytesPerPixel;
+    uint8_t* dest = pixels + _segments[twin].start * bytesPerPixel;
+    _segment_runtimes[k] = _segment_runtimes[slot];
+    _next_times[k] = _next_times[slot];
+    _ran_bits[k / 32] |= (uint32_t)1 << (k % 32); // the copied frame and cycle flags are cleared next time
+    if(((_segments[seg].options ^ _segments[twin].options) & REVERSE) == 0) {
+      memmove(dest, src, len * bytesPerPixel);
+    } else {
+      for(pixel_index_t n=0; n < len; n++) {
+        memmove(dest + (len - 1 - n) * bytesPerPixel, src + n * bytesPerPixel, bytesPerPixel);
+      }
+      // the reversed copy's ring buffer runs the other way
+      pixel_index_t head = _segment_runtimes[k].head;
+      if(head) _segment_runtimes[k].head = len - head;
+    }
+    _twins[k] = slot;
+  }
+}
+
+#endif
@@ -0,0 +1,243 @@
+/*
+  framecache.cpp - WS2812FX frame cache functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // frame caches are not supported on ATtiny devices
+
+// each recorded frame starts with a header, followed by the compressed pixel data
+typedef struct Frame_header {
+  uint32_t size;            // number of bytes of compressed pixel data
+  uint16_t delay;           // the delay the effect returned
+  WS2812FX::segment_runtime rt; // the runtime after the effect ran
+} frame_header;
+
+/*
+ * Cache a segment's effect. Many effects (like rainbow cycle, theater chase,
+ * running lights, fade and breath) are periodic: after a number of frames
+ * they're back at a frame they've been at before, and repeat exactly the same
+ * frames. With a frame cache, the effect's frames are recorded (compressed)
+ * until the effect repeats itself, after which the frames are replayed from
+ * the cache instead of rendering the effect. Changing any of the segment's
+ * settings (or the global brightness) starts a new recording. If the period
+ * doesn't fit in the given number of bytes, the effect just runs as usual.
+ * Only use frame caches for effects that don't use random numbers, or the
+ * current time. Set bytes to zero to turn the cache off.
+ */
+void WS2812FX::setFrameCache(segment_id_t seg, uint32_t bytes) {
+  if(seg >= _segments_len) return;
+
+  if(_caches == NULL) {
+    if(bytes == 0) return;
+    _caches = (frame_cache *)calloc(_segments_len, sizeof(frame_cache));
+    if(_caches == NULL) return;
+    _run_cached = &WS2812FX::runCached;
+  }
+
+  // the frames buffer is allocated when recording starts
+  frame_cache* fc = &_caches[seg];
+  free(fc->frames);
+  *fc = frame_cache();
+  fc->budget = bytes;
+  fc->state = CACHE_RECORDING; // start recording the next time the effect runs
+}
+
+// returns true if the segment's effect is being replayed from its frame cache
+bool WS2812FX::isCached(segment_id_t seg) {
+  return _caches != NULL && seg < _segments_len && _caches[seg].state == CACHE_REPLAYING;
+}
+
+// returns true if the runtimes are at the same point in the effect, ignoring timing
+static bool isSameState(const WS2812FX::segment_runtime* a, const WS2812FX::segment_runtime* b) {
+  return a->counter_mode_step == b->counter_mode_step &&
+    a->aux_param == b->aux_param &&
+    ((a->aux_param2 ^ b->aux_param2) & ~(FRAME | CYCLE)) == 0 &&
+    a->aux_param3 == b->aux_param3 &&
+    a->extDataSrc == b->extDataSrc &&
+    a->extDataCnt == b->extDataCnt &&
+    a->head == b->head;
+}
+
+/*
+ * Run the current segment's mode through its frame cache.
+ */
+uint16_t WS2812FX::runCached(segment_id_t seg) {
+  frame_cache* fc = &_caches[seg];
+
+  // record from scratch if anything changed since the last frame
+  uint8_t brightness = _out_pixels == NULL ? Adafruit_NeoPixel::getBrightness() : 0;
+  uint8_t scale = segmentScale(seg);
+  bool isChanged = memcmp(&fc->fx, _seg, sizeof(segment)) != 0 || fc->brightness != brightness || fc->scale != scale;
+  bool isStarting = fc->state == CACHE_RECORDING && fc->frames == NULL;
+  if(isChanged || isStarting || (fc->state != CACHE_FAILED && !isSameState(&fc->rt, _seg_rt))) {
+    fc->fx = *_seg;
+    fc->brightness = brightness;
+    fc->scale = scale;
+    fc->size = 0;
+    fc->state = CACHE_RECORDING;
+    if(fc->frames == NULL) fc->frames = (uint8_t *)malloc(fc->budget);
+    if(fc->frames == NULL) fc->state = CACHE_FAILED;
+    else recordFrame(fc, 0); // the starting point
+  }
+
+  uint16_t delay = fc->state == CACHE_REPLAYING ? replayFrame(fc) : runMode();
+  if(fc->state == CACHE_RECORDING) recordFrame(fc, delay);
+  fc->rt = *_seg_rt;
+  return delay;
+}
+
+// pixel n of a segment, in the order it's shown
+static inline const uint8_t* shownPixel(const uint8_t* base, pixel_index_t n, pixel_index_t len, pixel_index_t head, uint8_t bytesPerPixel) {
+  if(n < len && head) n = ((uint32_t)n + head) % len;
+  return base + n * bytesPerPixel;
+}
+
+/*
+ * Append the current segment's pixel data to the frame cache. The pixels are
+ * recorded in the order they're shown (unrolling the ring buffer of effects
+ * that scroll with shiftPixels()), and compressed into runs of repeated pixels
+ * and runs of literal pixels, each run starting with a count byte.
+ */
+void WS2812FX::recordFrame(frame_cache* fc, uint16_t delay) {
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  pixel_index_t stop = _seg->stop < numLEDs ? _seg->stop : numLEDs - 1;
+  pixel_index_t count = _seg->start <= stop ? stop + 1 - _seg->start : 0;
+  pixel_index_t len = (count + _seg_scale - 1) / _seg_scale;
+  pixel_index_t segLen = (_seg_len + _seg_scale - 1) / _seg_scale;
+  pixel_index_t head = len == segLen ? _seg_rt->head % segLen : 0;
+
+  // make sure the worst case fits, or give up
+  uint32_t bound = sizeof(frame_header) + (uint32_t)count * bytesPerPixel + (count + 127) / 128;
+  if(fc->size + bound > fc->budget) {
+    free(fc->frames);
+    fc->frames = NULL;
+    fc->state = CACHE_FAILED;
+    return;
+  }
+
+  const uint8_t* base = pixels + _seg->start * bytesPerPixel;
+  uint8_t* out = fc->frames + fc->size + sizeof(frame_header);
+  uint8_t* p = out;
+  pixel_index_t n = 0;
+  while(n < count) {
+    const uint8_t* c = shownPixel(base, n, len, head, bytesPerPixel);
+    uint16_t run = 1;
+    while(n + run < count && run < 128 && memcmp(c, shownPixel(base, n + run, len, head, bytesPerPixel), bytesPerPixel) == 0) run++;
+    if(run > 1) { // a run of repeated pixels
+      *p++ = 0x80 | (run - 1);
+      memcpy(p, c, bytesPerPixel);
+      p += bytesPerPixel;
+      n += run;
+    } else { // a run of literal pixels, up to the start of the next repeated run
+      uint8_t* countByte = p++;
+      uint8_t lit = 0;
+      do {
+        memcpy(p, shownPixel(base, n, len, head, bytesPerPixel), bytesPerPixel);
+        p += bytesPerPixel;
+        n++;
+        lit++;
+      } while(n < count && lit < 128 && !(n + 1 < count &&
+        memcmp(shownPixel(base, n, len, head, bytesPerPixel), shownPixel(base, n + 1, len, head, bytesPerPixel), bytesPerPixel) == 0));
+      *countByte = lit - 1;
+    }
+  }
+
+  frame_header header;
+  header.size = p - out;
+  header.delay = delay;
+  header.rt = *_seg_rt;
+  header.rt.head = 0;
+  memcpy(fc->frames + fc->size, &header, sizeof(frame_header));
+
+  // if the effect is back at a frame it has been at before, the frames from
+  // there on repeat. Drop the frames before it (the effect starting up) and
+  // this frame, and start replaying.
+  for(uint32_t pos=0; pos < fc->size; ) {
+    frame_header prev;
+    memcpy(&prev, fc->frames + pos, sizeof(frame_header));
+    if(prev.size == header.size && isSameState(&prev.rt, &header.rt) &&
+      memcmp(fc->frames + pos + sizeof(frame_header), out, header.size) == 0) {
+      prev.delay = delay; // the frame comes round again, with this frame's delay and flags
+      prev.rt = header.rt;
+      memcpy(fc->frames + pos, &prev, sizeof(frame_header));
+      fc->size -= pos;
+      memmove(fc->frames, fc->frames + pos, fc->size);
+      fc->pos = sizeof(frame_header) + prev.size;
+      if(fc->pos >= fc->size) fc->pos = 0;
+      fc->state = CACHE_REPLAYING;
+      return;
+    }
+    pos += sizeof(frame_header) + prev.size;
+  }
+  fc->size += sizeof(frame_header) + header.size;
+}
+
+/*
+ * Replay the next frame from the frame cache, returns the recorded delay.
+ */
+uint16_t WS2812FX::replayFrame(frame_cache* fc) {
+  frame_header header;
+  memcpy(&header, fc->frames + fc->pos, sizeof(frame_header));
+
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  const uint8_t* in = fc->frames + fc->pos + sizeof(frame_header);
+  const uint8_t* end = in + header.size;
+  uint8_t* p = pixels + _seg->start * bytesPerPixel;
+  while(in < end) {
+    uint8_t c = *in++;
+    if(c & 0x80) { // a run of repeated pixels
+      for(uint8_t i=0; i <= (c & 0x7f); i++) {
+        memcpy(p, in, bytesPerPixel);
+        p += bytesPerPixel;
+      }
+      in += bytesPerPixel;
+    } else { // a run of literal pixels
+      uint16_t bytes = (c + 1) * bytesPerPixel;
+      memcpy(p, in, bytes);
+      p += bytes;
+      in += bytes;
+    }
+  }
+
+  // the effect continues from this frame if the cache is turned off
+  _seg_rt->counter_mode_step = header.rt.counter_mode_step;
+  _seg_rt->aux_param = header.rt.aux_param;
+  _seg_rt->aux_param2 = header.rt.aux_param2;
+  _seg_rt->aux_param3 = header.rt.aux_param3;
+  _seg_rt->head = 0;
+
+  fc->pos = end - fc->frames;
+  if(fc->pos >= fc->size) fc->pos = 0;
+  return header.delay;
+}
+
+#endif
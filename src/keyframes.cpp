@@ -0,0 +1,133 @@
+/*
+  keyframes.cpp - WS2812FX keyframe interpolation functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // keyframes are not supported on ATtiny devices
+
+/*
+ * Render a segment's effect as keyframes, at most one every ms milliseconds,
+ * and have the output stage fill in the frames in between by interpolating
+ * from the previous keyframe to the latest one. Smooth, expensive effects can
+ * then render at a low frame rate, while the LEDs are still updated every
+ * OUTPUT_INTERVAL ms. The LEDs run one keyframe behind the effect. An effect
+ * that asks to be called more often than every ms milliseconds is still run
+ * that often, all at once just before each keyframe, so effects that move one
+ * step per call keep their speed. Set ms to zero to turn keyframes off.
+ */
+void WS2812FX::setKeyframeInterval(segment_id_t seg, uint16_t ms) {
+  if(seg >= _segments_len) return;
+
+  if(_keyframes == NULL) {
+    if(ms == 0) return;
+    _keyframes = (segment_keyframes *)calloc(_segments_len, sizeof(segment_keyframes));
+    if(_keyframes == NULL) return;
+    _capture_keyframe = &WS2812FX::captureKeyframe;
+  }
+
+  // the keyframe buffers are (re)allocated when the next keyframe is rendered
+  segment_keyframes* kf = &_keyframes[seg];
+  free(kf->pixels);
+  kf->pixels = NULL;
+  kf->size = 0;
+  kf->interval = ms;
+  kf->period = 0;
+  if(ms) initOutput();
+}
+
+uint16_t WS2812FX::getKeyframeInterval(segment_id_t seg) {
+  return (_keyframes != NULL && seg < _segments_len) ? _keyframes[seg].interval : 0;
+}
+
+/*
+ * Save the current segment's pixel data as the previous keyframe, just before
+ * the segment's effect renders the next one. The rendered pixels are saved in
+ * the order they're shown, so the ring buffer of an effect that scrolls with
+ * shiftPixels() is unrolled.
+ */
+void WS2812FX::captureKeyframe(segment_id_t seg) {
+  segment_keyframes* kf = &_keyframes[seg];
+  if(_seg->start >= numLEDs) return;
+
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  pixel_index_t stop = _seg->stop < numLEDs ? _seg->stop : numLEDs - 1;
+  pixel_index_t size = (stop + 1 - _seg->start) * bytesPerPixel;
+  bool isFirst = kf->size != size;
+  if(isFirst) {
+    free(kf->pixels);
+    kf->pixels = (uint8_t *)malloc(size * 2);
+    kf->size = kf->pixels != NULL ? size : 0;
+    if(kf->pixels == NULL) return;
+  }
+
+  // the rendered pixels, taking the render scale into account
+  pixel_index_t len = (stop + 1 - _seg->start + _seg_scale - 1) / _seg_scale;
+  pixel_index_t segLen = (_seg_len + _seg_scale - 1) / _seg_scale;
+  pixel_index_t head = (_seg_rt->head % segLen) * bytesPerPixel;
+  if(segLen != len) head = 0;
+
+  uint8_t* src = pixels + _seg->start * bytesPerPixel;
+  memcpy(kf->pixels, src + head, len * bytesPerPixel - head);
+  memcpy(kf->pixels + len * bytesPerPixel - head, src, head);
+
+  unsigned long now = millis();
+  kf->period = !isFirst && now - kf->time < 65536 ? now - kf->time : 0;
+  kf->time = now;
+}
+
+/*
+ * Returns the pixel data the output stage should show for a segment: the
+ * latest keyframe, or a frame interpolated between the previous keyframe and
+ * the latest one. len is the number of rendered pixels, head points to the
+ * rendered pixels' ring buffer head, which is zero for the interpolated frame.
+ */
+const uint8_t* WS2812FX::interpolateKeyframe(segment_id_t seg, const uint8_t* src, pixel_index_t len, pixel_index_t* head) {
+  segment_keyframes* kf = &_keyframes[seg];
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  if(kf->period == 0 || kf->size < len * bytesPerPixel) return src;
+
+  uint32_t elapsed = millis() - kf->time;
+  if(elapsed >= kf->period) return src;
+  _output_pending = true; // the frame changes over time, so keep the LEDs updated
+
+  // blend the previous keyframe with the latest one, unrolling the latest one's ring buffer
+  uint8_t blendAmt = (elapsed << 8) / kf->period;
+  pixel_index_t split = (len - *head) * bytesPerPixel;
+  uint8_t* prev = kf->pixels;
+  uint8_t* frame = kf->pixels + kf->size;
+  blend(frame, prev, (uint8_t*)src + *head * bytesPerPixel, split, blendAmt);
+  blend(frame + split, prev + split, (uint8_t*)src, *head * bytesPerPixel, blendAmt);
+  *head = 0;
+  return frame;
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+  layers.cpp - WS2812FX effect layer functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // layers are not supported on ATtiny devices
+
+/*
+ * Layers stack extra effects on top of a segment. Each layer runs its own
+ * mode, with its own colors and speed, on the same LEDs as the segment it's
+ * stacked on, and the output stage blends the layers with the segment before
+ * the LEDs are updated. A layer only needs a pixel buffer the size of its
+ * segment, so layers are much cheaper than running extra WS2812FX instances.
+ */
+void WS2812FX::setLayer(uint8_t n, segment_id_t seg, uint8_t mode, uint32_t color, uint16_t speed, uint8_t blend) {
+  const uint32_t colors[] = {color, 0, 0};
+  setLayer(n, seg, mode, colors, speed, NO_OPTIONS, blend);
+}
+
+void WS2812FX::setLayer(uint8_t n, segment_id_t seg, uint8_t mode, const uint32_t colors[], uint16_t speed, uint8_t options, uint8_t blend) {
+  if(n >= MAX_NUM_LAYERS || seg >= _segments_len) return;
+
+  initOutput();
+  if(_layers == NULL) {
+    _layers = new segment_layer[MAX_NUM_LAYERS]();
+    for(uint8_t i=0; i < MAX_NUM_LAYERS; i++) _layers[i].seg = INACTIVE_SEGMENT;
+    _service_layers = &WS2812FX::serviceLayers;
+  }
+
+  segment_layer* layer = &_layers[n];
+  layer->fx.mode = mode < getModeCount() ? mode : getModeCount() - 1;
+  layer->fx.speed = speed;
+  layer->fx.options = options;
+  for(uint8_t i=0; i<MAX_NUM_COLORS; i++) {
+    layer->fx.colors[i] = colors[i];
+  }
+  layer->seg = seg;
+  layer->blend = blend;
+  layer->opacity = 255;
+  layer->rt = segment_runtime();
+  layer->next_time = 0;
+  if(layer->pixels != NULL) memset(layer->pixels, 0, layer->len * getNumBytesPerPixel());
+}
+
+void WS2812FX::setLayerOpacity(uint8_t n, uint8_t opacity) {
+  if(_layers != NULL && n < MAX_NUM_LAYERS) _layers[n].opacity = opacity;
+}
+
+void WS2812FX::removeLayer(uint8_t n) {
+  if(_layers != NULL && n < MAX_NUM_LAYERS) {
+    free(_layers[n].pixels);
+    _layers[n].pixels = NULL;
+    _layers[n].len = 0;
+    _layers[n].seg = INACTIVE_SEGMENT;
+  }
+}
+
+WS2812FX::Segment_layer* WS2812FX::getLayer(uint8_t n) {
+  return (_layers != NULL && n < MAX_NUM_LAYERS) ? &_layers[n] : NULL;
+}
+
+/*
+ * Run the mode of each layer that's due. Layers on idle segments don't run.
+ * Returns true if any layer changed its pixel data.
+ */
+bool WS2812FX::serviceLayers(unsigned long now) {
+  bool doShow = false;
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(uint8_t i=0; i < MAX_NUM_LAYERS; i++) {
+    segment_layer* layer = &_layers[i];
+    if(layer->seg == INACTIVE_SEGMENT || !isActiveSegment(layer->seg)) continue;
+
+    // (re)allocate the layer's pixel buffer to match the segment's length
+    pixel_index_t len = _segments[layer->seg].stop - _segments[layer->seg].start + 1;
+    if(layer->len != len) {
+      free(layer->pixels);
+      layer->pixels = allocBuffer(len * bytesPerPixel, PSRAM_BUFFERS);
+      layer->len = layer->pixels != NULL ? len : 0;
+      if(layer->pixels != NULL) memset(layer->pixels, 0, len * bytesPerPixel);
+      layer->next_time = 0;
+    }
+    if(layer->pixels == NULL) continue;
+
+    layer->rt.aux_param2 &= ~(FRAME | CYCLE);
+    if(now > layer->next_time || _triggered) {
+      layer->rt.aux_param2 |= FRAME;
+      doShow = true;
+      _seg_matrix = _matrices != NULL ? &_matrices[layer->seg] : NULL;
+      _seg_origin = _segments[layer->seg].start;
+      _seg_scale = segmentScale(layer->seg);
+      uint16_t delay = renderShadow(&layer->fx, &layer->rt, layer->pixels, layer->len);
+      layer->next_time = now + (delay > SPEED_MIN ? delay : SPEED_MIN);
+      layer->rt.counter_mode_call++;
+    }
+  }
+  return doShow;
+}
+
+#endif
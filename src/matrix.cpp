@@ -0,0 +1,302 @@
+/*
+  matrix.cpp - WS2812FX matrix functions and effects
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // matrices are not supported on ATtiny devices
+
+/*
+ * Lay a segment out as a matrix of width x height LEDs. The segment's pixel
+ * data is always in row order (left to right, top to bottom), so effects can
+ * work on whole rows of contiguous pixel data. If the matrix is wired in a
+ * serpentine pattern (every other row wired right to left), the output stage
+ * reverses those rows just before the pixel data is sent to the LEDs.
+ *
+ * Effects that don't know about matrices still work on a matrix segment, they
+ * just see it as a strip. Matrix effects running on a segment that isn't a
+ * matrix see it as a matrix with one row. A matrix with no rows is ignored.
+ */
+void WS2812FX::setMatrix(segment_id_t seg, uint16_t width, uint16_t height, uint8_t options) {
+  if(seg >= _segments_len || height == 0) return;
+
+  if(_matrices == NULL) {
+    _matrices = (segment_matrix *)calloc(_segments_len, sizeof(segment_matrix));
+    if(_matrices == NULL) return;
+  }
+
+  if((options & MATRIX_SERPENTINE) == MATRIX_SERPENTINE) initOutput();
+  _matrices[seg].width = width;
+  _matrices[seg].height = height;
+  _matrices[seg].options = options;
+  _triggered = true;
+}
+
+void WS2812FX::removeMatrix(segment_id_t seg) {
+  if(_matrices != NULL && seg < _segments_len) _matrices[seg].width = 0;
+  _triggered = true;
+}
+
+WS2812FX::Segment_matrix* WS2812FX::getMatrix(segment_id_t seg) {
+  return (_matrices != NULL && seg < _segments_len && _matrices[seg].width) ? &_matrices[seg] : NULL;
+}
+
+/*
+ * Reverse the serpentine rows of the matrix segments, so the pixel data is in
+ * the order the LEDs are wired.
+ */
+void WS2812FX::encodeMatrices(uint8_t* buf) {
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg == INACTIVE_SEGMENT) continue;
+
+    segment_matrix* matrix = &_matrices[seg];
+    if(matrix->width == 0 || (matrix->options & MATRIX_SERPENTINE) != MATRIX_SERPENTINE) continue;
+
+    pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+    pixel_index_t rows = (stop + 1 - _segments[seg].start) / matrix->width;
+    if(rows > matrix->height) rows = matrix->height;
+    for(uint16_t y=1; y < rows; y += 2) {
+      uint8_t* left  = buf + (_segments[seg].start + (pixel_index_t)y * matrix->width) * bytesPerPixel;
+      uint8_t* right = left + (matrix->width - 1) * bytesPerPixel;
+      while(left < right) {
+        for(uint8_t b=0; b < bytesPerPixel; b++) {
+          uint8_t tmp = left[b];
+          left[b] = right[b];
+          right[b] = tmp;
+        }
+        left += bytesPerPixel;
+        right -= bytesPerPixel;
+      }
+    }
+  }
+}
+
+/* #####################################################
+#
+#  Matrix helper functions
+#
+##################################################### */
+
+// number of LEDs in each row of the current segment. A segment without a
+// matrix layout is one row, at most 65535 LEDs wide, matrix effects leave the
+// rest of a longer segment alone
+uint16_t WS2812FX::getMatrixWidth(void) {
+  if(_seg_matrix != NULL && _seg_matrix->width) return _seg_matrix->width;
+  return _seg_len < 65535 ? _seg_len : 65535;
+}
+
+// number of rows in the current segment, only complete rows are counted
+uint16_t WS2812FX::getMatrixHeight(void) {
+  if(_seg_matrix == NULL || _seg_matrix->width == 0) return 1;
+  pixel_index_t rows = _seg_len / _seg_matrix->width;
+  return rows < _seg_matrix->height ? rows : _seg_matrix->height;
+}
+
+// index of the LED at column x, row y of the current segment
+pixel_index_t WS2812FX::XY(uint16_t x, uint16_t y) {
+  return _seg->start + (pixel_index_t)y * getMatrixWidth() + x;
+}
+
+void WS2812FX::setPixelColorXY(uint16_t x, uint16_t y, uint32_t c) {
+  if(x < getMatrixWidth() && y < getMatrixHeight()) setPixelColor(XY(x, y), c);
+}
+
+uint32_t WS2812FX::getPixelColorXY(uint16_t x, uint16_t y) {
+  return (x < getMatrixWidth() && y < getMatrixHeight()) ? getPixelColor(XY(x, y)) : BLACK;
+}
+
+void WS2812FX::fillRow(uint16_t y, uint32_t c) {
+  if(y < getMatrixHeight()) fill(c, XY(0, y), getMatrixWidth());
+}
+
+void WS2812FX::fillColumn(uint16_t x, uint32_t c) {
+  uint16_t width = getMatrixWidth(), height = getMatrixHeight();
+  if(x >= width) return;
+  for(uint16_t y=0; y < height; y++) {
+    setPixelColor(XY(x, y), c);
+  }
+}
+
+/*
+ * Scroll the current segment's pixel data dx columns to the right (or left,
+ * if dx is negative) and dy rows down (or up, if dy is negative). The
+ * pixels that are scrolled in are black. Rows are contiguous in the pixel
+ * data, so scrolling moves whole blocks of pixel data, instead of
+ * setting each pixel.
+ */
+void WS2812FX::scrollMatrix(int16_t dx, int16_t dy) {
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  uint16_t width = getMatrixWidth(), height = getMatrixHeight();
+  pixel_index_t rowBytes = (pixel_index_t)width * bytesPerPixel;
+  uint8_t* base = pixels + _seg->start * bytesPerPixel;
+  if(_seg->start + (pixel_index_t)width * height > numLEDs) return;
+
+  if(dy != 0) {
+    uint16_t n = dy > 0 ? dy : -dy; // rows to scroll
+    if(n >= height) {
+      memset(base, 0, height * rowBytes);
+      return;
+    }
+    if(dy > 0) {
+      memmove(base + n * rowBytes, base, (height - n) * rowBytes);
+      memset(base, 0, n * rowBytes);
+    } else {
+      memmove(base, base + n * rowBytes, (height - n) * rowBytes);
+      memset(base + (height - n) * rowBytes, 0, n * rowBytes);
+    }
+  }
+
+  if(dx != 0) {
+    uint16_t n = dx > 0 ? dx : -dx; // columns to scroll
+    if(n > width) n = width;
+    pixel_index_t moveBytes = (width - n) * bytesPerPixel;
+    for(uint16_t y=0; y < height; y++) {
+      uint8_t* row = base + y * rowBytes;
+      if(dx > 0) {
+        memmove(row + n * bytesPerPixel, row, moveBytes);
+        memset(row, 0, n * bytesPerPixel);
+      } else {
+        memmove(row, row + n * bytesPerPixel, moveBytes);
+        memset(row + moveBytes, 0, n * bytesPerPixel);
+      }
+    }
+  }
+}
+
+/* #####################################################
+#
+#  Matrix effects
+#
+##################################################### */
+
+/*
+ * Drops of color falling down the matrix, leaving fading trails.
+ * If colors[0] == colors[1], the drops are random colors.
+ */
+uint16_t WS2812FX::mode_matrix_rain(void) {
+  uint16_t width = getMatrixWidth(), height = getMatrixHeight();
+  if(height == 0) return _seg->speed; // the segment is shorter than one row
+
+  scrollMatrix(0, 1);
+
+  // the new top row is a faded copy of the row below, which draws the
+  // trails behind the drops
+  for(uint16_t x=0; x < width; x++) {
+    uint32_t color = getPixelColorXY(x, 1);
+    if((color & 0xe0e0e0e0) == 0 && random8() < 16) { // start a new drop
+      color = (_seg->colors[0] == _seg->colors[1]) ? color_wheel(random8()) : _seg->colors[0];
+    } else {
+      color = color_blend(color, BLACK, 96);
+    }
+    setPixelColor(XY(x, 0), color);
+  }
+
+  if(_seg_rt->counter_mode_call % height == 0) SET_CYCLE;
+  return (_seg->speed / 16);
+}
+
+/*
+ * Rainbow plasma, made from three overlapping sine waves.
+ * The SIZE option sets the size of the plasma's blobs.
+ */
+uint16_t WS2812FX::mode_plasma(void) {
+  uint16_t width = getMatrixWidth(), height = getMatrixHeight();
+  uint8_t scale = 32 >> SIZE_OPTION;
+  uint8_t t = _seg_rt->counter_mode_step;
+
+  for(uint16_t y=0; y < height; y++) {
+    for(uint16_t x=0; x < width; x++) {
+      uint16_t v = sine8(x * scale + t) + sine8(y * scale + (t >> 1)) + sine8((x + y) * (scale >> 1) - t);
+      setPixelColor(XY(x, y), color_wheel(v / 3));
+    }
+  }
+
+  _seg_rt->counter_mode_step = (_seg_rt->counter_mode_step + 1) & 0xFF;
+  if(_seg_rt->counter_mode_step == 0) SET_CYCLE;
+  return (_seg->speed / 64);
+}
+
+/*
+ * Fire rising from the bottom of the matrix. The flames cool from yellow to
+ * red to black as they rise.
+ */
+uint16_t WS2812FX::mode_matrix_fire(void) {
+  uint16_t width = getMatrixWidth(), height = getMatrixHeight();
+  if(height == 0) return _seg->speed; // the segment is shorter than one row
+
+  scrollMatrix(0, -1);
+
+  // cool the flames, green cools faster than red, so the flames turn red
+  for(uint16_t y=0; y + 1 < height; y++) {
+    for(uint16_t x=0; x < width; x++) {
+      uint32_t color = getPixelColorXY(x, y);
+      uint8_t cooling = 16 + random8(32);
+      uint8_t r = (color >> 16) & 0xFF, g = (color >> 8) & 0xFF;
+      r = r > cooling ? r - cooling : 0;
+      g = g > cooling * 2 ? g - cooling * 2 : 0;
+      setPixelColor(XY(x, y), ((uint32_t)r << 16) | ((uint32_t)g << 8));
+    }
+  }
+
+  // new flames at the bottom of the matrix
+  for(uint16_t x=0; x < width; x++) {
+    uint8_t heat = random8(128);
+    setPixelColor(XY(x, height - 1), ((uint32_t)255 << 16) | ((uint32_t)(heat * 2) << 8) | (heat > 112 ? 64 : 0));
+  }
+
+  SET_CYCLE;
+  return (_seg->speed / 32);
+}
+
+/*
+ * Rainbow bars scrolling across the matrix, right to left (or left to right
+ * with the REVERSE option).
+ */
+uint16_t WS2812FX::mode_matrix_scroll(void) {
+  uint16_t width = getMatrixWidth();
+  uint8_t size = 2 << SIZE_OPTION;
+
+  if(IS_REVERSE) {
+    scrollMatrix(1, 0);
+    fillColumn(0, color_wheel(_seg_rt->counter_mode_step));
+  } else {
+    scrollMatrix(-1, 0);
+    fillColumn(width - 1, color_wheel(_seg_rt->counter_mode_step));
+  }
+
+  _seg_rt->counter_mode_step = (_seg_rt->counter_mode_step + size) & 0xFF;
+  if(_seg_rt->counter_mode_step < size) SET_CYCLE;
+  return (_seg->speed / 16);
+}
+
+#endif
@@ -0,0 +1,241 @@
+/*
+  memory.cpp - WS2812FX memory placement functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // memory placement is not supported on ATtiny devices
+
+#if defined(WS2812FX_SIMULATE_PSRAM)
+/*
+ * Host builds can simulate the two kinds of RAM of an ESP32 with PSRAM, to
+ * test memory policies without the hardware. Define WS2812FX_SIMULATE_PSRAM
+ * as the size of the largest block of internal RAM (e.g. 100000): larger
+ * blocks can't be allocated in internal RAM, as in an ESP32's fragmented
+ * heap. PSRAM blocks come from malloc() too, and are tracked so isPSRAM()
+ * can tell them apart.
+ */
+#define SIM_PSRAM_BLOCKS 64
+
+static struct {
+  const uint8_t* ptr;
+  size_t size;
+} simBlocks[SIM_PSRAM_BLOCKS];
+
+// forget the tracked blocks that a new block overlaps, they have been freed
+static uint8_t* simTrack(uint8_t* ptr, size_t size, bool isPSRAM) {
+  if(ptr == NULL) return NULL;
+  int8_t slot = -1;
+  for(uint8_t i=0; i < SIM_PSRAM_BLOCKS; i++) {
+    if(simBlocks[i].ptr != NULL && ptr < simBlocks[i].ptr + simBlocks[i].size && simBlocks[i].ptr < ptr + size) {
+      simBlocks[i].ptr = NULL;
+    }
+    if(simBlocks[i].ptr == NULL && slot < 0) slot = i;
+  }
+  if(!isPSRAM) return ptr;
+  if(slot < 0) { // too many PSRAM blocks to track
+    free(ptr);
+    return NULL;
+  }
+  simBlocks[slot].ptr = ptr;
+  simBlocks[slot].size = size;
+  return ptr;
+}
+
+static uint8_t* psramAlloc(size_t size) {
+  return simTrack((uint8_t*)malloc(size), size, true);
+}
+
+static uint8_t* internalAlloc(size_t size) {
+  return size > WS2812FX_SIMULATE_PSRAM ? NULL : simTrack((uint8_t*)malloc(size), size, false);
+}
+
+static uint8_t* heapAlloc(size_t size) {
+  return internalAlloc(size);
+}
+
+bool WS2812FX::isPSRAM(const void* ptr) {
+  for(uint8_t i=0; i < SIM_PSRAM_BLOCKS; i++) {
+    if(simBlocks[i].ptr != NULL && ptr >= simBlocks[i].ptr && ptr < simBlocks[i].ptr + simBlocks[i].size) return true;
+  }
+  return false;
+}
+
+#elif defined(ESP32) && __has_include(<esp_heap_caps.h>) // host builds of the tools define ESP32 too
+  #include <esp_heap_caps.h>
+  #if __has_include(<esp_memory_utils.h>)
+    #include <esp_memory_utils.h> // esp_ptr_external_ram()
+  #else
+    #include <soc/soc_memory_layout.h>
+  #endif
+
+static uint8_t* psramAlloc(size_t size) {
+  return (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+static uint8_t* internalAlloc(size_t size) {
+  return (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+// malloc() may put large blocks in PSRAM, depending on the core's settings
+static uint8_t* heapAlloc(size_t size) {
+  return (uint8_t*)malloc(size);
+}
+
+bool WS2812FX::isPSRAM(const void* ptr) {
+  return ptr != NULL && esp_ptr_external_ram(ptr);
+}
+
+#else // no PSRAM
+static uint8_t* psramAlloc(size_t size) {
+  (void)size;
+  return NULL;
+}
+
+static uint8_t* internalAlloc(size_t size) {
+  return (uint8_t*)malloc(size);
+}
+
+static uint8_t* heapAlloc(size_t size) {
+  return (uint8_t*)malloc(size);
+}
+
+bool WS2812FX::isPSRAM(const void* ptr) {
+  (void)ptr;
+  return false;
+}
+#endif
+
+/*
+ * Choose which buffers are put in PSRAM, on ESP32 boards that have it.
+ * PSRAM_PIXELS puts the pixel data the effects render into in PSRAM, and
+ * PSRAM_BUFFERS the output stage, transition and layer buffers, which are
+ * all as large as the strip (or the layer's segment). Effects run slower on
+ * pixel data in PSRAM, but a long strip may not fit in internal RAM at all.
+ * Buffers that are already allocated are moved, later ones are allocated
+ * where the policy puts them. A buffer that doesn't fit where the policy puts
+ * it is allocated in the other kind of RAM.
+ *
+ * Pixel data in PSRAM is copied to a staging buffer in internal RAM before
+ * it's sent to the LEDs, since DMA drivers can't read PSRAM. With outputs
+ * set, each output is copied (or converted) in turn, so the staging buffer
+ * only needs to be as large as the largest output. Without outputs, it's as
+ * large as the strip. If there isn't enough internal RAM for the staging
+ * buffer, the pixel data is sent directly from PSRAM.
+ */
+void WS2812FX::setMemoryPolicy(uint8_t policy) {
+  _memory_policy = policy;
+  placeBuffers();
+
+  if(policy == PSRAM_NONE) {
+    free(_stage_pixels);
+    _stage_pixels = NULL;
+    _stage_num_bytes = 0;
+  }
+
+  // outputs convert their pixel data in the staging buffer, instead of a buffer
+  // of their own, if there's enough internal RAM for it
+  if(_outputs != NULL) {
+    for(uint8_t i=0; i < MAX_NUM_OUTPUTS; i++) {
+      WS2812FXOutput* output = _outputs[i];
+      if(output != NULL) output->setStaged(policy != PSRAM_NONE && stageBuffer(output->getNumBytes()) != NULL);
+    }
+  }
+}
+
+uint8_t WS2812FX::getMemoryPolicy(void) {
+  return _memory_policy;
+}
+
+/*
+ * Allocate a buffer in PSRAM if the memory policy has the flag set, otherwise
+ * with malloc(). Falls back to the other kind of RAM if there isn't enough.
+ */
+uint8_t* WS2812FX::allocBuffer(size_t size, uint8_t flag) {
+  uint8_t* buf = NULL;
+  if(_memory_policy & flag) buf = psramAlloc(size);
+  if(buf == NULL) buf = heapAlloc(size);
+  if(buf == NULL) buf = psramAlloc(size); // too large for internal RAM
+  return buf;
+}
+
+// move a buffer to PSRAM or internal RAM, as the memory policy has the flag set or not.
+// With PSRAM_NONE, buffers malloc() put in PSRAM are moved to internal RAM too, if they fit
+void WS2812FX::moveBuffer(uint8_t** buf, size_t size, uint8_t flag) {
+  if(*buf == NULL || size == 0) return;
+  bool toPSRAM = (_memory_policy & flag) != 0;
+  if(isPSRAM(*buf) == toPSRAM) return;
+
+  uint8_t* moved = toPSRAM ? psramAlloc(size) : internalAlloc(size);
+  if(moved == NULL) return; // leave it where it is
+  memcpy(moved, *buf, size);
+  free(*buf);
+  *buf = moved;
+}
+
+// move the strip sized buffers to where the memory policy puts them
+void WS2812FX::placeBuffers(void) {
+  moveBuffer(&pixels, numBytes, PSRAM_PIXELS);
+
+  moveBuffer(&_out_pixels, _out_num_bytes, PSRAM_BUFFERS);
+  moveBuffer(&_map_pixels, _out_num_bytes, PSRAM_BUFFERS);
+  moveBuffer(&_scratch_pixels, _scratch_num_bytes, PSRAM_BUFFERS);
+  if(_layers != NULL) {
+    for(uint8_t i=0; i < MAX_NUM_LAYERS; i++) {
+      moveBuffer(&_layers[i].pixels, _layers[i].len * getNumBytesPerPixel(), PSRAM_BUFFERS);
+    }
+  }
+}
+
+// returns the staging buffer, (re)allocated in internal RAM to hold at least size bytes
+uint8_t* WS2812FX::stageBuffer(size_t size) {
+  if(_stage_num_bytes < size) {
+    free(_stage_pixels);
+    _stage_pixels = internalAlloc(size);
+    _stage_num_bytes = _stage_pixels != NULL ? size : 0;
+  }
+  return _stage_pixels;
+}
+
+/*
+ * If the pixel data about to be shown is in PSRAM, copy the first size bytes
+ * to the staging buffer, and swap it in for show() or the custom show
+ * function. execShow() restores the pixels pointer after the show.
+ */
+void WS2812FX::stagePixels(size_t size) {
+  if(_memory_policy == PSRAM_NONE || !isPSRAM(pixels)) return;
+  uint8_t* stage = stageBuffer(size);
+  if(stage == NULL) return;
+  memcpy(stage, pixels, size);
+  pixels = stage;
+}
+
+#endif
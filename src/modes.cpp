@@ -137,11 +137,11 @@ uint16_t WS2812FX::mode_random_color(void) {
 uint16_t WS2812FX::mode_single_dynamic(void) {
   uint8_t size = 1 << SIZE_OPTION;
   if(_seg_rt->counter_mode_call == 0) { // initialize segment with random colors
-    for(uint16_t i=_seg->start; i <= _seg->stop; i+=size) {
+    for(pixel_index_t i=_seg->start; i <= _seg->stop; i+=size) {
       fill(color_wheel(random8()), i, size);
     }
   }
-  uint16_t first = _seg->start + (random16(_seg_len / size + 1) * size);
+  pixel_index_t first = _seg->start + (randomIndex(_seg_len / size + 1) * size);
   fill(color_wheel(random8()), first, size);
   SET_CYCLE;
   return (_seg->speed / 16) ;
@@ -154,11 +154,11 @@ uint16_t WS2812FX::mode_single_dynamic(void) {
 uint16_t WS2812FX::mode_multi_dynamic(void) {
   if(SIZE_OPTION) {
     uint8_t size = 1 << SIZE_OPTION;
-    for(uint16_t i=_seg->start; i <= _seg->stop; i+=size) {
+    for(pixel_index_t i=_seg->start; i <= _seg->stop; i+=size) {
       fill(color_wheel(random8()), i, size);
     }
   } else {
-    for(uint16_t i=_seg->start; i <= _seg->stop; i++) {
+    for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
       setPixelColor(i, color_wheel(random8()));
     }
   }
@@ -245,14 +245,7 @@ uint16_t WS2812FX::mode_rainbow(void) {
  * Cycles a rainbow over the entire string of LEDs.
  */
 uint16_t WS2812FX::mode_rainbow_cycle(void) {
-  uint32_t color = color_wheel(_seg_rt->counter_mode_step);
-  if(IS_REVERSE) {
-    copyPixels(_seg->start, _seg->start + 1, _seg_len - 1);
-    setPixelColor(_seg->stop, color);
-  } else {
-    copyPixels(_seg->start + 1, _seg->start, _seg_len - 1);
-    setPixelColor(_seg->start, color);
-  }
+  shiftPixels(color_wheel(_seg_rt->counter_mode_step));
 
   uint8_t colorIndexIncr =  256 / _seg_len;
   if(colorIndexIncr == 0) colorIndexIncr = 1;
@@ -304,7 +297,7 @@ uint16_t WS2812FX::mode_running_lights(void) {
   uint8_t size = 1 << SIZE_OPTION;
   uint8_t sineIncr = (256 / _seg_len) * size;
   sineIncr = sineIncr > 1 ? sineIncr : 1;
-  for(uint16_t i=0; i < _seg_len; i++) {
+  for(pixel_index_t i=0; i < _seg_len; i++) {
     int lum = (int)sine8(((i + _seg_rt->counter_mode_step) * sineIncr));
     uint32_t color = color_blend(_seg->colors[0], _seg->colors[1], lum);
     if(IS_REVERSE) {
@@ -373,7 +366,7 @@ uint16_t WS2812FX::mode_hyper_sparkle(void) {
 
   uint8_t size = 1 << SIZE_OPTION;
   for(uint8_t i=0; i<8; i++) {
-    fill(WHITE, _seg->start + random16(_seg_len - size + 1), size);
+    fill(WHITE, _seg->start + randomIndex(_seg_len - size + 1), size);
   }
 
   SET_CYCLE;
@@ -444,8 +437,8 @@ uint16_t WS2812FX::mode_chase_random(void) {
  * Rainbow running on white.
  */
 uint16_t WS2812FX::mode_chase_rainbow_white(void) {
-  uint16_t n = _seg_rt->counter_mode_step;
-  uint16_t m = (_seg_rt->counter_mode_step + 1) % _seg_len;
+  pixel_index_t n = _seg_rt->counter_mode_step;
+  pixel_index_t m = (_seg_rt->counter_mode_step + 1) % _seg_len;
   uint32_t color2 = color_wheel(((n * 256 / _seg_len) + (_seg_rt->counter_mode_call & 0xFF)) & 0xFF);
   uint32_t color3 = color_wheel(((m * 256 / _seg_len) + (_seg_rt->counter_mode_call & 0xFF)) & 0xFF);
 
@@ -543,7 +536,7 @@ uint16_t WS2812FX::mode_larson_scanner(void) {
       setPixelColor(_seg->start + _seg_rt->counter_mode_step, _seg->colors[0]);
     }
   } else {
-    uint16_t index = (_seg_len * 2) - _seg_rt->counter_mode_step - 2;
+    pixel_index_t index = (_seg_len * 2) - _seg_rt->counter_mode_step - 2;
     if(IS_REVERSE) {
       setPixelColor(_seg->stop - index, _seg->colors[0]);
     } else {
@@ -552,7 +545,7 @@ uint16_t WS2812FX::mode_larson_scanner(void) {
   }
 
   _seg_rt->counter_mode_step++;
-  if(_seg_rt->counter_mode_step >= (uint16_t)((_seg_len * 2) - 2)) {
+  if(_seg_rt->counter_mode_step >= (pixel_index_t)((_seg_len * 2) - 2)) {
     _seg_rt->counter_mode_step = 0;
     SET_CYCLE;
   }
@@ -631,7 +624,7 @@ uint16_t WS2812FX::mode_twinkleFOX(void) {
   uint32_t color2 = _seg->colors[2];
   uint32_t blendedColor;
 
-  for (uint16_t i = _seg->start; i <= _seg->stop; i+=size) {
+  for (pixel_index_t i = _seg->start; i <= _seg->stop; i+=size) {
     // Use Mark Kriegsman's clever idea of using pseudo-random numbers to determine
     // each LED's initial and increment blend values
     mySeed = (mySeed * 2053) + 13849; // a random, but deterministic, number
@@ -701,8 +694,8 @@ uint16_t WS2812FX::mode_block_dissolve(void) {
   uint32_t desColor = getPixelColor(_seg->start);
 
   // find a random pixel that isn't the target color and update it
-  for(uint16_t i=0; i<_seg_len; i++) {
-    int index = _seg->start + random16(_seg_len);
+  for(pixel_index_t i=0; i<_seg_len; i++) {
+    pixel_index_t index = _seg->start + randomIndex(_seg_len);
     if(getPixelColor(index) != desColor) {
       setPixelColor(index, color);
       return _seg->speed / 64;
@@ -721,10 +714,10 @@ uint16_t WS2812FX::mode_block_dissolve(void) {
 
 // ICU effect
 uint16_t WS2812FX::mode_icu(void) {
-  uint16_t pos = _seg_rt->counter_mode_step; // current eye position
-  uint16_t dest = _seg_rt->aux_param3;       // eye destination
-  uint16_t index = _seg->start + pos;        // index of the first eye
-  uint16_t index2 = index + _seg_len/2;      // index of the second eye
+  pixel_index_t pos = _seg_rt->counter_mode_step; // current eye position
+  pixel_index_t dest = _seg_rt->aux_param3;       // eye destination
+  pixel_index_t index = _seg->start + pos;        // index of the first eye
+  pixel_index_t index2 = index + _seg_len/2;      // index of the second eye
 
   setPixelColor(index, BLACK); // erase the current eyes
   setPixelColor(index2, BLACK);
@@ -743,7 +736,7 @@ uint16_t WS2812FX::mode_icu(void) {
     } else {
       setPixelColor(index, _seg->colors[0]);
       setPixelColor(index2, _seg->colors[0]);
-      _seg_rt->aux_param3 = random16(_seg_len/2); // set a new destination
+      _seg_rt->aux_param3 = randomIndex(_seg_len/2); // set a new destination
       SET_CYCLE;
       return 1000 + random16(2000); // pause a second or two
     }
@@ -770,7 +763,15 @@ uint16_t WS2812FX::mode_dual_larson(void) {
 // Running random2 effect (simplified version of the custom RandomChase effect)
 uint16_t WS2812FX::mode_running_random2(void) {
   uint8_t size = 2 << SIZE_OPTION;
-  uint32_t color = IS_REVERSE ? getPixelColor(_seg->stop): getPixelColor(_seg->start);
+
+  // read back the pixel that running() set last. With the output stage in
+  // use, shiftPixels() sets it at the ring buffer's head, not the segment's end
+#if !defined(MEGATINYCORE)
+  pixel_index_t head = _seg_rt->head < _seg_len ? _seg_rt->head : 0;
+#else
+  pixel_index_t head = 0;
+#endif
+  uint32_t color = IS_REVERSE ? getPixelColor(_seg->start + (head ? head : _seg_len) - 1) : getPixelColor(_seg->start + head);
 
   // periodically change the color
   if((_seg_rt->counter_mode_step) % size == 0) {
@@ -837,7 +838,7 @@ uint16_t WS2812FX::mode_rainbow_larson(void) {
 }
 
 uint16_t WS2812FX::mode_rainbow_fireworks(void) {
-  for(uint16_t i=_seg->start; i <= _seg->stop; i++) {
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
     uint32_t color = getRawPixelColor(i); // get the raw pixel color (ignore global brightness)
     color = (color >> 1) & 0x7F7F7F7F;    // fade all pixels
     setRawPixelColor(i, color);
@@ -866,8 +867,8 @@ uint16_t WS2812FX::mode_rainbow_fireworks(void) {
 
   // occasionally create a random red pixel
   if(random8(4) == 0) {
-    uint16_t rand16 = random16(_seg_len - 12 > 1 ? _seg_len - 12 : 1);
-    uint16_t index = _seg->start + 6 + rand16;
+    pixel_index_t rand16 = randomIndex(_seg_len - 12 > 1 ? _seg_len - 12 : 1);
+    pixel_index_t index = _seg->start + 6 + rand16;
     setRawPixelColor(index, RED); // set the raw pixel color (ignore global brightness)
     SET_CYCLE;
   }
@@ -911,8 +912,8 @@ uint16_t WS2812FX::mode_heartbeat(void) {
 
   // copy pixels from the middle of the segment to the edges
   uint16_t bytesPerPixelBlock = size * getNumBytesPerPixel();
-  uint16_t centerOffset = (_seg_len / 2) * getNumBytesPerPixel();
-  uint16_t byteCount = centerOffset - bytesPerPixelBlock;
+  pixel_index_t centerOffset = (_seg_len / 2) * getNumBytesPerPixel();
+  pixel_index_t byteCount = centerOffset - bytesPerPixelBlock;
   memmove(getPixels(), getPixels() + bytesPerPixelBlock, byteCount);
   memmove(getPixels() + centerOffset + bytesPerPixelBlock, getPixels() + centerOffset, byteCount);
 
@@ -920,13 +921,13 @@ uint16_t WS2812FX::mode_heartbeat(void) {
 
   int beatTimer = now - then;
   if((beatTimer > 400) && !_seg_rt->aux_param) { // time for the second beat? (400ms after the first beat)
-    uint16_t startLed = _seg->start + (_seg_len / 2) - size;
+    pixel_index_t startLed = _seg->start + (_seg_len / 2) - size;
     fill(_seg->colors[0], startLed, size * 2); // create the second beat
     
     _seg_rt->aux_param = true; // is second beat
   }
   if(beatTimer > 1200) { // time for the first beat? (1200ms)
-    uint16_t startLed = _seg->start + (_seg_len / 2) - size;
+    pixel_index_t startLed = _seg->start + (_seg_len / 2) - size;
     fill(_seg->colors[0], startLed, size * 2); // create the first beat
 
     _seg_rt->aux_param = false; // is first beat
@@ -951,12 +952,12 @@ uint16_t WS2812FX::mode_vu_meter(void) {
     }
   }
 
-  uint16_t channelSize = _seg_len / cnt; // num LEDs in each channel
+  pixel_index_t channelSize = _seg_len / cnt; // num LEDs in each channel
 
   for(uint8_t i=0; i<cnt; i++) {  // for each channel
     uint8_t scaledLevel = (src[i] * channelSize) / 256;
-    for(uint16_t j=0; j<channelSize; j++) {
-      uint16_t index = _seg->start + (i * channelSize) + j;
+    for(pixel_index_t j=0; j<channelSize; j++) {
+      pixel_index_t index = _seg->start + (i * channelSize) + j;
       if(j <= scaledLevel) {
         if(j < channelSize - 4)      setPixelColor(index, _seg->colors[0]); // green
         else if(j < channelSize - 2) setPixelColor(index, _seg->colors[1]); // yellow
@@ -984,7 +985,7 @@ uint16_t WS2812FX::mode_bits(void) {
     uint32_t color = color_wheel(_seg_rt->aux_param++); // rainbow of colors
 
     for(uint8_t i=0; i < cnt; i++) {
-      uint16_t index = _seg->start + (i * ledsPerBit * 2);
+      pixel_index_t index = _seg->start + (i * ledsPerBit * 2);
       if(src[i]) {
         fill(color, index, ledsPerBit);              // bit == 1
         fill(BLACK, index + ledsPerBit, ledsPerBit); // space
@@ -1060,11 +1061,11 @@ uint16_t WS2812FX::mode_flipbook(void) {
     // cast external data array to Flipbook struct
     Flipbook* _flipbook = (Flipbook*) _seg_rt->extDataSrc;
 
-    uint16_t segIndex = _seg->start;
-    uint8_t pageIndex = _seg_rt->aux_param * _flipbook->numRows * _flipbook->numCols; // aux_param will store the page index
+    pixel_index_t segIndex = _seg->start;
+    uint32_t pageIndex = _seg_rt->aux_param * _flipbook->numRows * _flipbook->numCols; // aux_param will store the page index
 
     for(int rowIndex=0; rowIndex < _flipbook->numRows; rowIndex++) {
-      uint16_t pageRowIndex = pageIndex + (rowIndex * _flipbook->numCols);
+      uint32_t pageRowIndex = pageIndex + (rowIndex * _flipbook->numCols);
       for(int colIndex=0; colIndex < _flipbook->numCols; colIndex++) {
         if(segIndex <= _seg->stop) {
           setPixelColor(segIndex, _flipbook->colors[pageRowIndex + colIndex]);
@@ -1112,7 +1113,7 @@ uint16_t WS2812FX::mode_popcorn(void) {
 
     // if kernel is active, turn on the appropriate LED
     if(src[i].position >= 0.0f) {
-      uint16_t ledIndex = IS_REVERSE ? _seg->stop - src[i].position : _seg->start + src[i].position;
+      pixel_index_t ledIndex = IS_REVERSE ? _seg->stop - src[i].position : _seg->start + src[i].position;
       if(ledIndex >= _seg->start && ledIndex <= _seg->stop) setPixelColor(ledIndex, src[i].color);
     }
   }
@@ -1143,7 +1144,7 @@ uint16_t WS2812FX::mode_oscillator(void) {
   }
 
   // update LEDs based on new positions
-  for(uint16_t i=0; i < _seg_len; i++) {
+  for(pixel_index_t i=0; i < _seg_len; i++) {
     // if the oscillators overlap, blend their colors
     uint32_t blendedcolor = BLACK;
     for(uint8_t j=0; j < cnt; j++) {
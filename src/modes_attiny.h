@@ -29,6 +29,7 @@
   CHANGELOG
 
   2022-03-23   Separated from the original WS2812FX.h file
+  2026-10-19   FX_MODE_CUSTOM_0 selects the custom mode
 */
 #ifndef mode_attiny_h
 #define mode_attiny_h
@@ -79,7 +80,7 @@
 #define FX_MODE_OSCILLATOR              31
 #endif
 
-#define FX_MODE_CUSTOM_0                 0  // custom modes are not supported and will simply run the STATIC effect
+#define FX_MODE_CUSTOM_0     (MODE_COUNT - 1)  // only one custom mode is supported, and it's always the last mode
 
 // create GLOBAL names to allow WS2812FX to compile with sketches and other libs
 // that store strings in PROGMEM (get rid of the "section type conflict with __c"
@@ -29,6 +29,9 @@
   CHANGELOG
 
   2022-03-23   Separated from the original WS2812FX.h file
+  2026-10-19   Added matrix effects
+  2026-10-19   Added spatial effects
+  2026-10-19   Added clip effect
 */
 #ifndef mode_esp_h
 #define mode_esp_h
@@ -109,15 +112,24 @@
 #define FX_MODE_FLIPBOOK                69
 #define FX_MODE_POPCORN                 70
 #define FX_MODE_OSCILLATOR              71
-#define FX_MODE_CUSTOM                  72  // keep this for backward compatiblity
-#define FX_MODE_CUSTOM_0                72  // custom modes need to go at the end
-#define FX_MODE_CUSTOM_1                73
-#define FX_MODE_CUSTOM_2                74
-#define FX_MODE_CUSTOM_3                75
-#define FX_MODE_CUSTOM_4                76
-#define FX_MODE_CUSTOM_5                77
-#define FX_MODE_CUSTOM_6                78
-#define FX_MODE_CUSTOM_7                79
+#define FX_MODE_MATRIX_RAIN             72
+#define FX_MODE_PLASMA                  73
+#define FX_MODE_MATRIX_FIRE             74
+#define FX_MODE_MATRIX_SCROLL           75
+#define FX_MODE_PLANE_SWEEP             76
+#define FX_MODE_SPHERES                 77
+#define FX_MODE_NOISE_FIELD             78
+#define FX_MODE_SPATIAL_WIPE            79
+#define FX_MODE_CLIP                    80
+#define FX_MODE_CUSTOM                  81  // keep this for backward compatiblity
+#define FX_MODE_CUSTOM_0                81  // custom modes need to go at the end
+#define FX_MODE_CUSTOM_1                82
+#define FX_MODE_CUSTOM_2                83
+#define FX_MODE_CUSTOM_3                84
+#define FX_MODE_CUSTOM_4                85
+#define FX_MODE_CUSTOM_5                86
+#define FX_MODE_CUSTOM_6                87
+#define FX_MODE_CUSTOM_7                88
 
 typedef struct Mode {
   const __FlashStringHelper* name;
@@ -130,6 +142,8 @@ const char cat_simple[]  PROGMEM = "Simple";
 const char cat_wipe[]    PROGMEM = "Wipe";
 const char cat_sweep[]   PROGMEM = "Sweep";
 const char cat_special[] PROGMEM = "Special";
+const char cat_matrix[]  PROGMEM = "Matrix";
+const char cat_spatial[] PROGMEM = "Spatial";
 const char cat_custom[]  PROGMEM = "Custom";
 
 // create GLOBAL names to allow WS2812FX to compile with sketches and other libs
@@ -207,14 +221,23 @@ const char name_68[] PROGMEM = "Multi Comet";
 const char name_69[] PROGMEM = "Flipbook";
 const char name_70[] PROGMEM = "Popcorn";
 const char name_71[] PROGMEM = "Oscillator";
-const char name_72[] PROGMEM = "Custom 0"; // custom modes need to go at the end
-const char name_73[] PROGMEM = "Custom 1";
-const char name_74[] PROGMEM = "Custom 2";
-const char name_75[] PROGMEM = "Custom 3";
-const char name_76[] PROGMEM = "Custom 4";
-const char name_77[] PROGMEM = "Custom 5";
-const char name_78[] PROGMEM = "Custom 6";
-const char name_79[] PROGMEM = "Custom 7";
+const char name_72[] PROGMEM = "Matrix Rain";
+const char name_73[] PROGMEM = "Plasma";
+const char name_74[] PROGMEM = "Matrix Fire";
+const char name_75[] PROGMEM = "Matrix Scroll";
+const char name_76[] PROGMEM = "Plane Sweep";
+const char name_77[] PROGMEM = "Spheres";
+const char name_78[] PROGMEM = "Noise Field";
+const char name_79[] PROGMEM = "Spatial Wipe";
+const char name_80[] PROGMEM = "Clip";
+const char name_81[] PROGMEM = "Custom 0"; // custom modes need to go at the end
+const char name_82[] PROGMEM = "Custom 1";
+const char name_83[] PROGMEM = "Custom 2";
+const char name_84[] PROGMEM = "Custom 3";
+const char name_85[] PROGMEM = "Custom 4";
+const char name_86[] PROGMEM = "Custom 5";
+const char name_87[] PROGMEM = "Custom 6";
+const char name_88[] PROGMEM = "Custom 7";
 
 // define static array of member function pointers.
 // make sure the order of the _modes array elements matches the FX_MODE_* values
@@ -291,13 +314,22 @@ __attribute__ ((unused)) static mode _modes[] = {
   { FSH(name_69), FSH(cat_special), &WS2812FX::mode_flipbook},
   { FSH(name_70), FSH(cat_special), &WS2812FX::mode_popcorn},
   { FSH(name_71), FSH(cat_special), &WS2812FX::mode_oscillator},
-  { FSH(name_72), FSH(cat_custom),  &WS2812FX::mode_custom_0 },
-  { FSH(name_73), FSH(cat_custom),  &WS2812FX::mode_custom_1 },
-  { FSH(name_74), FSH(cat_custom),  &WS2812FX::mode_custom_2 },
-  { FSH(name_75), FSH(cat_custom),  &WS2812FX::mode_custom_3 },
-  { FSH(name_76), FSH(cat_custom),  &WS2812FX::mode_custom_4 },
-  { FSH(name_77), FSH(cat_custom),  &WS2812FX::mode_custom_5 },
-  { FSH(name_78), FSH(cat_custom),  &WS2812FX::mode_custom_6 },
-  { FSH(name_79), FSH(cat_custom),  &WS2812FX::mode_custom_7 }
+  { FSH(name_72), FSH(cat_matrix),  &WS2812FX::mode_matrix_rain },
+  { FSH(name_73), FSH(cat_matrix),  &WS2812FX::mode_plasma },
+  { FSH(name_74), FSH(cat_matrix),  &WS2812FX::mode_matrix_fire },
+  { FSH(name_75), FSH(cat_matrix),  &WS2812FX::mode_matrix_scroll },
+  { FSH(name_76), FSH(cat_spatial), &WS2812FX::mode_plane_sweep },
+  { FSH(name_77), FSH(cat_spatial), &WS2812FX::mode_spheres },
+  { FSH(name_78), FSH(cat_spatial), &WS2812FX::mode_noise_field },
+  { FSH(name_79), FSH(cat_spatial), &WS2812FX::mode_spatial_wipe },
+  { FSH(name_80), FSH(cat_special), &WS2812FX::mode_clip },
+  { FSH(name_81), FSH(cat_custom),  &WS2812FX::mode_custom_0 },
+  { FSH(name_82), FSH(cat_custom),  &WS2812FX::mode_custom_1 },
+  { FSH(name_83), FSH(cat_custom),  &WS2812FX::mode_custom_2 },
+  { FSH(name_84), FSH(cat_custom),  &WS2812FX::mode_custom_3 },
+  { FSH(name_85), FSH(cat_custom),  &WS2812FX::mode_custom_4 },
+  { FSH(name_86), FSH(cat_custom),  &WS2812FX::mode_custom_5 },
+  { FSH(name_87), FSH(cat_custom),  &WS2812FX::mode_custom_6 },
+  { FSH(name_88), FSH(cat_custom),  &WS2812FX::mode_custom_7 }
 };
 #endif
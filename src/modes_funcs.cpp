@@ -35,8 +35,8 @@
 /*
   overload Adafruit_NeoPixel fill() function to respect segment boundaries
 */
-void WS2812FX::fill(uint32_t c, uint16_t first, uint16_t count) {
-  uint16_t i, end;
+void WS2812FX::fill(uint32_t c, pixel_index_t first, pixel_index_t count) {
+  pixel_index_t i, end;
 
   // If first LED is past end of strip or outside segment boundaries, nothing to do
   if (first >= numLEDs || first < _seg->start || first > _seg->stop) {
@@ -129,7 +129,7 @@ uint16_t WS2812FX::scan(uint32_t color1, uint32_t color2, bool dual) {
     _seg_rt->aux_param = 0;
     SET_CYCLE;
   }
-  if(_seg_rt->counter_mode_step >= (uint16_t)(_seg_len - size)) _seg_rt->aux_param = 1;
+  if(_seg_rt->counter_mode_step >= (pixel_index_t)(_seg_len - size)) _seg_rt->aux_param = 1;
 
   return (_seg->speed / (_seg_len * 2));
 }
@@ -142,7 +142,7 @@ uint16_t WS2812FX::tricolor_chase(uint32_t color1, uint32_t color2, uint32_t col
   uint8_t sizeCnt2 = sizeCnt + sizeCnt;
   uint8_t sizeCnt3 = sizeCnt2 + sizeCnt;
   uint16_t index = _seg_rt->counter_mode_step % sizeCnt3;
-  for(uint16_t i=0; i < _seg_len; i++, index++) {
+  for(pixel_index_t i=0; i < _seg_len; i++, index++) {
     index = index % sizeCnt3;
 
     uint32_t color = color3;
@@ -156,7 +156,11 @@ uint16_t WS2812FX::tricolor_chase(uint32_t color1, uint32_t color2, uint32_t col
     }
   }
 
-  _seg_rt->counter_mode_step++;
+  // wrap the step counter once the pattern and the cycle line up again, so
+  // the effect is periodic (and can be replayed from a frame cache)
+  pixel_index_t a = sizeCnt3, b = _seg_len;
+  while(b) { pixel_index_t t = a % b; a = b; b = t; } // a = gcd(sizeCnt3, _seg_len)
+  _seg_rt->counter_mode_step = (_seg_rt->counter_mode_step + 1) % ((uint32_t)sizeCnt3 * _seg_len / a);
   if(_seg_rt->counter_mode_step % _seg_len == 0) SET_CYCLE;
 
   return (_seg->speed / 16);
@@ -168,12 +172,12 @@ uint16_t WS2812FX::tricolor_chase(uint32_t color1, uint32_t color2, uint32_t col
 uint16_t WS2812FX::twinkle(uint32_t color1, uint32_t color2) {
   if(_seg_rt->counter_mode_step == 0) {
     fill(color2, _seg->start, _seg_len);
-    uint16_t min_leds = (_seg_len / 4) + 1; // make sure, at least one LED is on
+    pixel_index_t min_leds = (_seg_len / 4) + 1; // make sure, at least one LED is on
     _seg_rt->counter_mode_step = random(min_leds, min_leds * 2);
     SET_CYCLE;
   }
 
-  setPixelColor(_seg->start + random16(_seg_len), color1);
+  setPixelColor(_seg->start + randomIndex(_seg_len), color1);
 
   _seg_rt->counter_mode_step--;
   return (_seg->speed / _seg_len);
@@ -200,7 +204,7 @@ void WS2812FX::fade_out(uint32_t targetColor) {
   int g2 = (color >>  8) & 0xff;
   int b2 =  color        & 0xff;
 
-  for(uint16_t i=_seg->start; i <= _seg->stop; i++) {
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
     color = getPixelColor(i); // current color
     if(rate == 0) { // old fade-to-black algorithm
       setPixelColor(i, (color >> 1) & 0x7F7F7F7F);
@@ -237,13 +241,13 @@ uint32_t WS2812FX::color_blend(uint32_t color1, uint32_t color2, uint8_t blendAm
   return blendedColor;
 }
 
-uint8_t* WS2812FX::blend(uint8_t *dest, uint8_t *src1, uint8_t *src2, uint16_t cnt, uint8_t blendAmt) {
+uint8_t* WS2812FX::blend(uint8_t *dest, uint8_t *src1, uint8_t *src2, pixel_index_t cnt, uint8_t blendAmt) {
   if(blendAmt == 0) {
     memmove(dest, src1, cnt);
   } else if(blendAmt == 255) {
     memmove(dest, src2, cnt);
   } else {
-    for(uint16_t i=0; i<cnt; i++) {
+    for(pixel_index_t i=0; i<cnt; i++) {
 //    dest[i] = map(blendAmt, 0, 255, src1[i], src2[i]);
       dest[i] =  blendAmt * ((int)src2[i] - (int)src1[i]) / 256 + src1[i]; // map() function
     }
@@ -259,7 +263,7 @@ uint16_t WS2812FX::twinkle_fade(uint32_t color) {
 
   if(random8(3) == 0) {
     uint8_t size = 1 << SIZE_OPTION;
-    uint16_t index = _seg->start + random16(_seg_len - size + 1);
+    pixel_index_t index = _seg->start + randomIndex(_seg_len - size + 1);
     fill(color, index, size);
     SET_CYCLE;
   }
@@ -279,7 +283,7 @@ uint16_t WS2812FX::sparkle(uint32_t color1, uint32_t color2) {
   uint8_t size = 1 << SIZE_OPTION;
   fill(color1, _seg->start + _seg_rt->aux_param3, size);
 
-  _seg_rt->aux_param3 = random16(_seg_len - size + 1); // aux_param3 stores the random led index
+  _seg_rt->aux_param3 = randomIndex(_seg_len - size + 1); // aux_param3 stores the random led index
   fill(color2, _seg->start + _seg_rt->aux_param3, size);
 
   SET_CYCLE;
@@ -294,9 +298,9 @@ uint16_t WS2812FX::sparkle(uint32_t color1, uint32_t color2) {
 uint16_t WS2812FX::chase(uint32_t color1, uint32_t color2, uint32_t color3) {
   uint8_t size = 1 << SIZE_OPTION;
   for(uint8_t i=0; i<size; i++) {
-    uint16_t a = (_seg_rt->counter_mode_step + i) % _seg_len;
-    uint16_t b = (a + size) % _seg_len;
-    uint16_t c = (b + size) % _seg_len;
+    pixel_index_t a = (_seg_rt->counter_mode_step + i) % _seg_len;
+    pixel_index_t b = (a + size) % _seg_len;
+    pixel_index_t c = (b + size) % _seg_len;
     if(IS_REVERSE) {
       setPixelColor(_seg->stop - a, color1);
       setPixelColor(_seg->stop - b, color2);
@@ -325,8 +329,8 @@ uint16_t WS2812FX::chase_flash(uint32_t color1, uint32_t color2) {
 
   if(flash_step < (flash_count * 2)) {
     uint32_t color = (flash_step % 2 == 0) ? color2 : color1;
-    uint16_t n = _seg_rt->counter_mode_step;
-    uint16_t m = (_seg_rt->counter_mode_step + 1) % _seg_len;
+    pixel_index_t n = _seg_rt->counter_mode_step;
+    pixel_index_t m = (_seg_rt->counter_mode_step + 1) % _seg_len;
     if(IS_REVERSE) {
       setPixelColor(_seg->stop - n, color);
       setPixelColor(_seg->stop - m, color);
@@ -353,13 +357,7 @@ uint16_t WS2812FX::running(uint32_t color1, uint32_t color2) {
   uint8_t size = 2 << SIZE_OPTION;
   uint32_t color = (_seg_rt->counter_mode_step & size) ? color1 : color2;
 
-  if(IS_REVERSE) {
-    copyPixels(_seg->start, _seg->start + 1, _seg_len - 1);
-    setPixelColor(_seg->stop, color);
-  } else {
-    copyPixels(_seg->start + 1, _seg->start, _seg_len - 1);
-    setPixelColor(_seg->start, color);
-  }
+  shiftPixels(color);
 
   _seg_rt->counter_mode_step++;
   if((_seg_rt->counter_mode_step % _seg_len) == 0) SET_CYCLE;
@@ -375,9 +373,9 @@ uint16_t WS2812FX::fireworks(uint32_t color) {
 // for better performance, manipulate the Adafruit_NeoPixels pixels[] array directly
   uint8_t *pixels = getPixels();
   uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
-  uint16_t startPixel = _seg->start * bytesPerPixel + bytesPerPixel;
-  uint16_t stopPixel = _seg->stop * bytesPerPixel;
-  for(uint16_t i=startPixel; i <stopPixel; i++) {
+  pixel_index_t startPixel = _seg->start * bytesPerPixel + bytesPerPixel;
+  pixel_index_t stopPixel = _seg->stop * bytesPerPixel;
+  for(pixel_index_t i=startPixel; i <stopPixel; i++) {
     uint16_t tmpPixel = (pixels[i - bytesPerPixel] >> 2) +
       pixels[i] +
       (pixels[i + bytesPerPixel] >> 2);
@@ -386,18 +384,18 @@ uint16_t WS2812FX::fireworks(uint32_t color) {
 
   uint8_t size = 2 << SIZE_OPTION;
   if(!_triggered) {
-    uint16_t numBursts = _seg_len/20 > 1 ? _seg_len/20 : 1;
-    for(uint16_t i=0; i<numBursts; i++) {
+    pixel_index_t numBursts = _seg_len/20 > 1 ? _seg_len/20 : 1;
+    for(pixel_index_t i=0; i<numBursts; i++) {
       if(random8(10) == 0) {
-        uint16_t index = _seg->start + random16(_seg_len - size + 1);
+        pixel_index_t index = _seg->start + randomIndex(_seg_len - size + 1);
         fill(color, index, size);
         SET_CYCLE;
       }
     }
   } else {
-    uint16_t numBursts = _seg_len/10 > 1 ? _seg_len/10 : 1;
-    for(uint16_t i=0; i<numBursts; i++) {
-      uint16_t index = _seg->start + random16(_seg_len - size + 1);
+    pixel_index_t numBursts = _seg_len/10 > 1 ? _seg_len/10 : 1;
+    for(pixel_index_t i=0; i<numBursts; i++) {
+      pixel_index_t index = _seg->start + randomIndex(_seg_len - size + 1);
       fill(color, index, size);
       SET_CYCLE;
     }
@@ -418,7 +416,7 @@ uint16_t WS2812FX::fire_flicker(int rev_intensity) {
   maxLum = maxLum > r ? maxLum : r;
   maxLum = maxLum > w ? maxLum : w;
   uint8_t lum = maxLum / rev_intensity;
-  for(uint16_t i=_seg->start; i <= _seg->stop; i++) {
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
     uint8_t flicker = random8(lum);
     uint8_t r2 = (r - flicker) > 0 ? (r - flicker) : 0;
     uint8_t g2 = (g - flicker) > 0 ? (g - flicker) : 0;
@@ -0,0 +1,385 @@
+/*
+  output.cpp - WS2812FX output stage functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+  2026-10-19   Added segment brightness, moved global brightness and gamma correction into the output stage
+  2026-10-19   Added global brightness ramping
+  2026-10-19   Added layer compositing
+  2026-10-19   Added segment transitions
+  2026-10-19   Added LED remapping
+  2026-10-19   Added serpentine matrices
+  2026-10-19   Added segment offsets
+  2026-10-19   Added ring buffer scrolling, segment offsets are applied while compositing
+  2026-10-19   Added reduced resolution rendering
+  2026-10-19   Added keyframe interpolation
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // the output stage is not supported on ATtiny devices
+
+/*
+ * The output stage sits between the effects and the LEDs. Effects render into
+ * the Adafruit_NeoPixel pixels array as usual, and the output stage writes the
+ * processed pixel data (brightness, gamma correction, power budget dimming)
+ * to a separate output buffer, leaving the rendered pixel data untouched for
+ * the effects to use in the next frame.
+ *
+ * The output stage is only started when a feature that needs it is used. From
+ * then on, the pixels array holds full brightness, uncorrected colors, and the
+ * global brightness and gamma correction are applied here instead of in
+ * setPixelColor().
+ */
+void WS2812FX::initOutput(void) {
+  if(_out_pixels != NULL) return;
+
+  _out_pixels = allocBuffer(numBytes, PSRAM_BUFFERS);
+  if(_out_pixels == NULL) return;
+  _out_num_bytes = numBytes;
+  _encode_output = &WS2812FX::encodeOutput;
+  _unroll_ring = &WS2812FX::unrollRing;
+
+  // take over the global brightness, and restore the rendered pixel data to full brightness
+  _brightness = _target_brightness = Adafruit_NeoPixel::getBrightness();
+  Adafruit_NeoPixel::setBrightness(255);
+  _triggered = true; // redraw segments with gamma correction, since it's no longer baked into the pixel data
+}
+
+// blend one byte of a layer's pixel data with the pixel data below it
+static inline uint8_t blendLayer(uint8_t below, uint8_t c, uint8_t blend, uint16_t opacity) {
+  switch(blend) {
+    case BLEND_ADD:
+      c = (c * opacity) >> 8;
+      return below + c > 255 ? 255 : below + c;
+    case BLEND_MAX:
+      c = (c * opacity) >> 8;
+      return c > below ? c : below;
+    case BLEND_SCREEN:
+      c = (c * opacity) >> 8;
+      return 255 - (((255 - below) * (256 - c)) >> 8);
+    default: // BLEND_ALPHA
+      return below + ((((int16_t)c - below) * (int32_t)opacity) >> 8);
+  }
+}
+
+// byte b of pixel n of a segment, with the segment's layers blended in on top of c
+static inline uint8_t compositeByte(uint8_t c, WS2812FX::segment_layer** layers, const pixel_index_t heads[], uint8_t numLayers, pixel_index_t n, uint8_t b, uint8_t bytesPerPixel) {
+  for(uint8_t k=0; k < numLayers; k++) {
+    pixel_index_t len = layers[k]->len;
+    if(n < len) {
+      uint32_t p = (uint32_t)n + heads[k];
+      if(p >= len) p -= len;
+      c = blendLayer(c, layers[k]->pixels[p * bytesPerPixel + b], layers[k]->blend, layers[k]->opacity + 1);
+    }
+  }
+  return c;
+}
+
+// the position in a ring buffer of pixel n, given the ring's head (head < segLen).
+// Pixels past the strip's end (len) aren't rotated.
+static inline pixel_index_t ringIndex(pixel_index_t n, pixel_index_t head, pixel_index_t segLen, pixel_index_t len) {
+  uint32_t p = (uint32_t)n + head;
+  if(p >= segLen) p -= segLen;
+  return p < len ? p : n;
+}
+
+// a segment's rendered pixel data, everything needed to composite one of its pixels
+typedef struct Segment_sources {
+  const uint8_t* pixels;    // the segment's pixel data, starting at the segment's first pixel
+  const uint8_t* scratch;   // the outgoing effect's pixel data, NULL if the segment isn't in transition
+  WS2812FX::segment_layer** layers;
+  const pixel_index_t* layerHeads;
+  uint8_t  numLayers;
+  uint8_t  style;           // transition style
+  uint16_t progress;        // transition progress (0-256)
+  pixel_index_t edge;       // transition's leading edge
+  pixel_index_t len;        // number of rendered pixels on the strip
+  pixel_index_t segLen;     // number of rendered pixels in the segment
+  pixel_index_t head;       // ring buffer heads
+  pixel_index_t transHead;
+  uint8_t  bytesPerPixel;
+  bool     isReverse;
+} segment_sources;
+
+// rendered pixel m of a segment, with its layers blended in and mixed with the outgoing effect
+static void compositePixel(const segment_sources& s, pixel_index_t m, uint8_t* c) {
+  uint16_t weight = 256; // how much of the new effect is shown, 0-256
+  if(s.scratch != NULL) {
+    // mix the new effect with the outgoing effect in the scratch buffer. Work
+    // out the pixel's position in the direction of the transition.
+    pixel_index_t pos = s.isReverse ? s.len - 1 - m : m;
+    switch(s.style & 0x0f) {
+      case TRANSITION_WIPE:
+        weight = pos < s.edge ? 256 : 0;
+        break;
+      case TRANSITION_DISSOLVE:
+        weight = (uint8_t)(pos * 167 + 13) < s.progress ? 256 : 0;
+        break;
+      case TRANSITION_PUSH: { // the new effect's last pixels come in first
+        bool isNew = pos < s.edge;
+        m = isNew ? s.len - s.edge + pos : pos - s.edge;
+        if(s.isReverse) m = s.len - 1 - m;
+        weight = isNew ? 256 : 0;
+        break;
+      }
+      default: // TRANSITION_FADE
+        weight = s.progress;
+    }
+  }
+
+  const uint8_t* src = s.pixels + ringIndex(m, s.head, s.segLen, s.len) * s.bytesPerPixel;
+  const uint8_t* old = s.scratch != NULL ? s.scratch + ringIndex(m, s.transHead, s.segLen, s.len) * s.bytesPerPixel : NULL;
+  for(uint8_t b=0; b < s.bytesPerPixel; b++) {
+    if(weight == 0) {
+      c[b] = old[b];
+    } else {
+      c[b] = compositeByte(src[b], s.layers, s.layerHeads, s.numLayers, m, b, s.bytesPerPixel);
+      if(weight < 256) c[b] = old[b] + ((((int16_t)c[b] - old[b]) * (int32_t)weight) >> 8);
+    }
+  }
+}
+
+// apply an easing curve to a transition's progress (0-256)
+static inline uint16_t ease(uint16_t p, uint8_t easing) {
+  switch(easing) {
+    case EASE_IN:
+      return (p * p) >> 8;
+    case EASE_OUT:
+      return 256 - (((256 - p) * (256 - p)) >> 8);
+    case EASE_IN_OUT:
+      return p < 128 ? (p * p) >> 7 : 256 - (((256 - p) * (256 - p)) >> 7);
+    default: // EASE_LINEAR
+      return p;
+  }
+}
+
+/*
+ * Returns true if the output buffer holds the pixel data to be shown.
+ */
+bool WS2812FX::encodeOutput(void) {
+  if(_out_pixels == NULL || numLEDs == 0) return false;
+
+  // reallocate the output buffer if the strip length has changed
+  if(_out_num_bytes != numBytes) {
+    free(_out_pixels);
+    free(_map_pixels);
+    _map_pixels = NULL;
+    _out_pixels = allocBuffer(numBytes, PSRAM_BUFFERS);
+    _out_num_bytes = _out_pixels != NULL ? numBytes : 0;
+    if(_out_pixels == NULL) return false;
+  }
+
+  // ramp the global brightness towards its target
+  if(_brightness != _target_brightness) {
+    unsigned long elapsed = millis() - _brightness_time;
+    if(elapsed >= _brightness_ramp) {
+      _brightness = _target_brightness;
+    } else {
+      _brightness = _start_brightness + ((int16_t)(_target_brightness - _start_brightness) * (int32_t)elapsed) / _brightness_ramp;
+      _output_pending = true;
+    }
+  }
+
+  // the global brightness applies to all pixels, including those not in any segment
+  uint16_t scale = _brightness + 1;
+  for(pixel_index_t i=0; i < numBytes; i++) {
+    _out_pixels[i] = (pixels[i] * scale) >> 8;
+  }
+
+  // re-encode the segments that have layers, their own brightness or gamma correction,
+  // and estimate each segment's current draw if power management is enabled
+  if(_segment_powers != NULL) memset(_segment_powers, 0, _segments_len * sizeof(segment_power));
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg == INACTIVE_SEGMENT) continue;
+
+    // find the layers stacked on this segment
+    segment_layer* layers[MAX_NUM_LAYERS];
+    pixel_index_t layerHeads[MAX_NUM_LAYERS];
+    uint8_t numLayers = 0;
+    for(uint8_t k=0; _layers != NULL && k < MAX_NUM_LAYERS; k++) {
+      if(_layers[k].seg == seg && _layers[k].pixels != NULL && _layers[k].opacity && _layers[k].len) {
+        layers[numLayers] = &_layers[k];
+        layerHeads[numLayers++] = _layers[k].rt.head % _layers[k].len;
+      }
+    }
+
+    // find the transition's progress, if the segment is in transition
+    segment_transition* trans = NULL;
+    uint16_t progress = 0;
+    if(_transitions != NULL && _transitions[seg].duration != 0 && _scratch_num_bytes == numBytes) {
+      trans = &_transitions[seg];
+      trans->shown = true;
+      uint32_t elapsed = millis() - trans->start_time;
+      progress = elapsed < trans->duration ? (elapsed << 8) / trans->duration : 256;
+      progress = ease(progress, trans->style & 0x30);
+    }
+
+    // effects rendering at a reduced scale only fill the start of the segment, effects
+    // that scroll with shiftPixels() leave their pixel data rotated by the ring's
+    // head, and the segment's offset rotates it some more
+    uint8_t factor = segmentScale(seg);
+    bool isLinear = factor > 1 && (_scales[seg] & SCALE_LINEAR) == SCALE_LINEAR;
+    pixel_index_t segLen = _segments[seg].stop + 1 - _segments[seg].start;
+    pixel_index_t shift = (segLen - _segments[seg].offset % segLen) % segLen;
+    pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+    pixel_index_t len = stop + 1 - _segments[seg].start;
+
+    segment_sources s;
+    s.segLen = (segLen + factor - 1) / factor;
+    s.len = (len + factor - 1) / factor;
+    s.head = _segment_runtimes[i].head % s.segLen;
+    s.transHead = trans != NULL ? trans->rt.head % s.segLen : 0;
+
+    bool isGamma = (_segments[seg].options & GAMMA) == GAMMA;
+    bool isKeyframed = _keyframes != NULL && _keyframes[seg].interval && (s.head == 0 || s.segLen == s.len);
+    if(!isGamma && _segments[seg].dimming == 0 && numLayers == 0 && trans == NULL && _segment_powers == NULL && s.head == 0 && shift == 0 && factor == 1 && !isKeyframed) continue;
+
+    uint16_t segScale = ((_brightness + 1) * (256 - _segments[seg].dimming)) >> 8;
+    pixel_index_t start = _segments[seg].start * bytesPerPixel;
+    s.pixels = pixels + start;
+    if(isKeyframed) s.pixels = interpolateKeyframe(seg, s.pixels, s.len, &s.head);
+    s.scratch = trans != NULL ? _scratch_pixels + start : NULL;
+    s.layers = layers;
+    s.layerHeads = layerHeads;
+    s.numLayers = numLayers;
+    s.style = trans != NULL ? trans->style : 0;
+    s.progress = progress;
+    s.edge = ((uint32_t)progress * s.len) >> 8;
+    s.bytesPerPixel = bytesPerPixel;
+    s.isReverse = (_segments[seg].options & REVERSE) == REVERSE;
+
+    uint32_t sum = 0;
+    uint8_t c[4], c1[4];
+    for(pixel_index_t n=0; n < len; n++) {
+      pixel_index_t m = ringIndex(n, shift, segLen, len); // the LED's position in the segment
+      if(factor == 1) {
+        compositePixel(s, m, c);
+      } else {
+        // upsample, LED m shows rendered pixel m / factor, or a mix of it and the next pixel
+        pixel_index_t q = m / factor;
+        compositePixel(s, q, c);
+        uint16_t frac = isLinear ? ((m % factor) << 8) / factor : 0;
+        if(frac && q + 1 < s.len) {
+          compositePixel(s, q + 1, c1);
+          for(uint8_t b=0; b < bytesPerPixel; b++) {
+            c[b] = c[b] + ((((int16_t)c1[b] - c[b]) * (int16_t)frac) >> 8);
+          }
+        }
+      }
+
+      uint8_t* dest = _out_pixels + start + n * bytesPerPixel;
+      for(uint8_t b=0; b < bytesPerPixel; b++) {
+        uint8_t cb = isGamma ? gamma8(c[b]) : c[b];
+        dest[b] = (cb * segScale) >> 8;
+        sum += dest[b];
+      }
+    }
+    if(_segment_powers != NULL) _segment_powers[seg].current = (sum * _incremental_current) / 1000;
+  }
+
+  // dim segments to stay within the power budget
+  if(_segment_powers != NULL) {
+    updatePowerBudget();
+    for(segment_id_t i=0; i < _active_segments_len; i++) {
+      segment_id_t seg = _active_segments[i];
+      if(seg != INACTIVE_SEGMENT && _segment_powers[seg].scale < 255) {
+        uint16_t powerScale = _segment_powers[seg].scale + 1;
+        pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+        for(pixel_index_t j = _segments[seg].start * bytesPerPixel; j < (stop + 1) * bytesPerPixel; j++) {
+          _out_pixels[j] = (_out_pixels[j] * powerScale) >> 8;
+        }
+      }
+    }
+  }
+
+  // reverse the serpentine rows of matrix segments
+  if(_matrices != NULL) encodeMatrices(_out_pixels);
+
+  // rearrange the pixel data to match the LED wiring. The output buffers are
+  // swapped, so the remapped pixel data ends up in _out_pixels.
+  if(_remap != NULL || _remap_runs != NULL) {
+    if(_map_pixels == NULL) _map_pixels = allocBuffer(numBytes, PSRAM_BUFFERS);
+    if(_map_pixels != NULL) {
+      remapOutput(_out_pixels, _map_pixels);
+      uint8_t* tmp = _out_pixels;
+      _out_pixels = _map_pixels;
+      _map_pixels = tmp;
+    }
+  }
+  return true;
+}
+
+/*
+ * Set a segment's brightness. Segment brightness is applied in the output
+ * stage, on top of the global brightness, so the effect's own pixel data is
+ * not changed.
+ */
+void WS2812FX::setSegmentBrightness(segment_id_t seg, uint8_t b) {
+  initOutput();
+  _segments[seg].dimming = 255 - b;
+  _output_pending = true;
+}
+
+uint8_t WS2812FX::getSegmentBrightness(segment_id_t seg) {
+  return 255 - _segments[seg].dimming;
+}
+
+/*
+ * Ramp global brightness changes over a period of time (ms), instead of
+ * changing the brightness in one step.
+ */
+void WS2812FX::setBrightnessRamp(uint16_t ms) {
+  if(ms) initOutput();
+  _brightness_ramp = ms;
+}
+
+// returns the global brightness, or the brightness being ramped to
+uint8_t WS2812FX::getBrightness(void) {
+  return _out_pixels != NULL ? _target_brightness : Adafruit_NeoPixel::getBrightness();
+}
+
+// once the output stage is in use the pixel data doesn't need to be
+// corrected for the global brightness
+uint32_t WS2812FX::getPixelColor(pixel_index_t n) {
+#if PIXEL_INDEX_BITS == 32 // Adafruit_NeoPixel::getPixelColor() can't reach past LED 65535
+  uint32_t c = getRawPixelColor(n);
+  if(_out_pixels != NULL || brightness == 0) return c;
+
+  // scale the color back up, the way Adafruit_NeoPixel does
+  uint8_t w = (uint8_t)(c >> 24), r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c;
+  return (((uint32_t)(w << 8) / brightness) << 24) | (((uint32_t)(r << 8) / brightness) << 16) |
+    (((uint32_t)(g << 8) / brightness) << 8) | ((uint32_t)(b << 8) / brightness);
+#else
+  return _out_pixels != NULL ? getRawPixelColor(n) : Adafruit_NeoPixel::getPixelColor(n);
+#endif
+}
+
+#endif
@@ -0,0 +1,181 @@
+/*
+  outputs.cpp - WS2812FX multiple output functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // multiple outputs are not supported on ATtiny devices
+
+/*
+ * Send the WS2812FX strip's pixel data to several physical LED strips, each
+ * on its own pin. Each output takes len LEDs of pixel data, starting at the
+ * offset LED, and can have its own pixel type (RGB or RGBW, and color order)
+ * and the REVERSE option, for strips that are wired back to front. Outputs
+ * whose pixel type matches the WS2812FX strip and aren't reversed send the
+ * pixel data directly, without copying it and without a pixel buffer of
+ * their own. Setting len to zero removes the output. Each output is one
+ * Adafruit_NeoPixel strip, which holds at most 65535 bytes of pixel data, so
+ * longer outputs are cut to 21845 RGB (16383 RGBW) LEDs.
+ *
+ * Once outputs are set, show() sends the pixel data to the outputs instead of
+ * the WS2812FX strip's own pin. Outputs are not used if a custom show function
+ * is set.
+ */
+void WS2812FX::setOutput(uint8_t n, int16_t pin, pixel_index_t offset, uint16_t len, neoPixelType type) {
+  setOutput(n, pin, offset, len, type, NO_OPTIONS);
+}
+
+void WS2812FX::setOutput(uint8_t n, int16_t pin, pixel_index_t offset, uint16_t len, neoPixelType type, uint8_t options) {
+  if(n >= MAX_NUM_OUTPUTS) return;
+
+  if(_outputs == NULL) _outputs = new WS2812FXOutput*[MAX_NUM_OUTPUTS]();
+  _show_outputs = &WS2812FX::showOutputs;
+  delete _outputs[n];
+  _outputs[n] = NULL;
+  if(len == 0) return;
+
+  uint8_t w = (type >> 6) & 0b11, r = (type >> 4) & 0b11, g = (type >> 2) & 0b11, b = type & 0b11;
+  bool isRGBW = w != r;
+  uint16_t maxLen = 65535 / (isRGBW ? 4 : 3);
+  if(len > maxLen) len = maxLen;
+
+  WS2812FXOutput* output = new WS2812FXOutput(len, pin, type, offset, options);
+  if(output->numPixels() == 0) { // not enough memory for the output's pixel buffer
+    delete output;
+    return;
+  }
+
+  // if the output's pixel type matches the strip's, and it's not reversed, it
+  // can send a span of the strip's pixel data, so doesn't need its own buffer
+  bool isSameType = r == rOffset && g == gOffset && b == bOffset && isRGBW == (wOffset != rOffset) && (!isRGBW || w == wOffset);
+  if(isSameType && (options & REVERSE) != REVERSE) output->useSpan();
+  output->setStaged(_memory_policy != PSRAM_NONE && stageBuffer(output->getNumBytes()) != NULL);
+
+  output->begin();
+  _outputs[n] = output;
+}
+
+WS2812FXOutput* WS2812FX::getOutput(uint8_t n) {
+  return (_outputs != NULL && n < MAX_NUM_OUTPUTS) ? _outputs[n] : NULL;
+}
+
+/*
+ * Send the pixel data to each output in turn. Spans of pixel data in PSRAM,
+ * and the outputs that don't have a buffer of their own (see setMemoryPolicy),
+ * go through the staging buffer in internal RAM, one output at a time.
+ */
+void WS2812FX::showOutputs(void) {
+  bool isInPSRAM = _memory_policy != PSRAM_NONE && isPSRAM(pixels);
+  for(uint8_t i=0; i < MAX_NUM_OUTPUTS; i++) {
+    WS2812FXOutput* output = _outputs[i];
+    if(output == NULL) continue;
+    uint8_t* stage = NULL;
+    if(output->isSpan() ? isInPSRAM : output->getPixels() == NULL) stage = stageBuffer(output->getNumBytes());
+    output->update(pixels, numLEDs, rOffset, gOffset, bOffset, wOffset, stage);
+  }
+}
+
+// free the output's own pixel buffer, it will send a span of the WS2812FX pixel data instead
+void WS2812FXOutput::useSpan(void) {
+  free(pixels);
+  pixels = NULL;
+  _is_span = true;
+}
+
+// when staged, the output converts its pixel data in the WS2812FX staging buffer, instead of a buffer of its own
+void WS2812FXOutput::setStaged(bool isStaged) {
+  if(_is_span) return;
+  if(isStaged) {
+    free(pixels);
+    pixels = NULL;
+  } else if(pixels == NULL) {
+    updateLength(numLEDs);
+  }
+}
+
+/*
+ * Convert the output's range of the WS2812FX pixel data (src) to the output's
+ * pixel type, and send it to the LEDs. If stage isn't NULL, the pixel data is
+ * copied or converted there, instead of the output's own buffer.
+ */
+void WS2812FXOutput::update(const uint8_t* src, pixel_index_t srcNumLEDs, uint8_t srcR, uint8_t srcG, uint8_t srcB, uint8_t srcW, uint8_t* stage) {
+  if(_offset + numLEDs > srcNumLEDs) return; // the output doesn't fit in the strip
+
+  uint8_t srcBytesPerPixel = (srcW == srcR) ? 3 : 4;
+  src += _offset * srcBytesPerPixel;
+
+  if(_is_span) {
+    if(stage != NULL) {
+      memcpy(stage, src, numBytes);
+      src = stage;
+    }
+    pixels = (uint8_t*)src;
+    Adafruit_NeoPixel::show();
+    pixels = NULL;
+    return;
+  }
+
+  uint8_t* ownPixels = pixels;
+  if(stage != NULL) pixels = stage;
+  if(pixels == NULL) return; // no staging buffer
+
+  bool isRGBW = wOffset != rOffset;
+  uint8_t bytesPerPixel = isRGBW ? 4 : 3;
+  bool isReverse = (_options & REVERSE) == REVERSE;
+  bool isSameType = srcR == rOffset && srcG == gOffset && srcB == bOffset && srcBytesPerPixel == bytesPerPixel && (!isRGBW || srcW == wOffset);
+
+  uint8_t* dest = isReverse ? pixels + (numLEDs - 1) * bytesPerPixel : pixels;
+  int8_t step = isReverse ? -bytesPerPixel : bytesPerPixel;
+  for(uint16_t i=0; i < numLEDs; i++) {
+    if(isSameType) { // only the order of the pixels changes
+      memcpy(dest, src, bytesPerPixel);
+    } else {
+      uint8_t r = src[srcR], g = src[srcG], b = src[srcB];
+      if(isRGBW) {
+        dest[wOffset] = srcBytesPerPixel == 4 ? src[srcW] : 0;
+      } else if(srcBytesPerPixel == 4) { // no white LED, so mix the white into the other colors
+        uint8_t w = src[srcW];
+        r = r + w > 255 ? 255 : r + w;
+        g = g + w > 255 ? 255 : g + w;
+        b = b + w > 255 ? 255 : b + w;
+      }
+      dest[rOffset] = r;
+      dest[gOffset] = g;
+      dest[bOffset] = b;
+    }
+    src += srcBytesPerPixel;
+    dest += step;
+  }
+  Adafruit_NeoPixel::show();
+  pixels = ownPixels;
+}
+
+#endif
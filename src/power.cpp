@@ -0,0 +1,306 @@
+/*
+  power.cpp - WS2812FX power estimation and power budget functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version, per segment power budgets
+  2026-10-19   Added thermal model, power-on ramp and energy estimates
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // power management is not supported on ATtiny devices
+
+/*
+ * Set the power budget for the entire strip in mA. If the estimated current
+ * draw exceeds the budget, segments are dimmed in priority order, lowest
+ * priority first. Setting the budget to zero disables the power budget.
+ */
+void WS2812FX::setMaxCurrent(uint16_t mA) {
+  if(mA) initPower();
+  _max_current = mA;
+}
+
+uint16_t WS2812FX::getMaxCurrent(void) {
+  return _max_current;
+}
+
+/*
+ * Set the power model used to estimate current draw:
+ * quiescent   - current draw of one LED that's turned off (uA)
+ * incremental - increase in current for each intensity step per color (uA)
+ */
+void WS2812FX::setPowerModel(uint16_t quiescent, uint16_t incremental) {
+  _quiescent_current = quiescent;
+  _incremental_current = incremental;
+}
+
+/*
+ * Set the supply voltage (mV), used to convert current estimates into
+ * energy estimates.
+ */
+void WS2812FX::setVoltage(uint16_t mV) {
+  _voltage = mV;
+}
+
+/*
+ * Limit the sustained current draw (mA). The average current draw is
+ * calculated over a rolling window (ms) and, if it exceeds the limit, the
+ * strip is gradually dimmed until the average is back within the limit.
+ * Use this for enclosed fixtures where heat builds up over time, even if the
+ * current never exceeds the power budget set by setMaxCurrent().
+ * The throttle never dims the strip below minThrottle (0-255), so the LEDs
+ * stay lit even if the limit can't be met.
+ * Setting the limit to zero disables the thermal model.
+ */
+void WS2812FX::setThermalLimit(uint16_t mA, uint32_t window, uint8_t minThrottle) {
+  if(mA == 0) {
+    delete _thermal;
+    _thermal = NULL;
+    return;
+  }
+
+  initPower();
+  if(_thermal == NULL) {
+    _thermal = new thermal_model();
+    _thermal->throttle = 255;
+  }
+  _thermal->max_current = mA;
+  _thermal->window = window > THERMAL_BUCKETS ? window : THERMAL_BUCKETS;
+  _thermal->min_throttle = minThrottle;
+  if(_thermal->throttle < minThrottle) _thermal->throttle = minThrottle;
+}
+
+/*
+ * Ramp the brightness up over a period of time (ms) when the strip is
+ * started, so all the LEDs don't turn on at once.
+ */
+void WS2812FX::setPowerOnRamp(uint16_t ms) {
+  if(ms) initPower();
+  _power_on_ramp = ms;
+}
+
+void WS2812FX::setPriority(segment_id_t seg, uint8_t p) {
+  _segments[seg].priority = p;
+}
+
+uint8_t WS2812FX::getPriority(segment_id_t seg) {
+  return _segments[seg].priority;
+}
+
+/*
+ * Returns the estimated current draw (mA) of the entire strip, as of the
+ * last show. Estimates are only made once one of the power management
+ * functions has been called.
+ */
+uint32_t WS2812FX::getCurrent(void) {
+  return _current;
+}
+
+/*
+ * Returns the estimated current draw (mA) of a segment, as of the last show.
+ */
+uint32_t WS2812FX::getCurrent(segment_id_t seg) {
+  if(_segment_powers == NULL || seg >= _segments_len) return 0;
+  return _segment_powers[seg].current;
+}
+
+/*
+ * Returns the average current draw (mA) over the thermal model's rolling window.
+ */
+uint32_t WS2812FX::getAverageCurrent(void) {
+  if(_thermal == NULL) return 0;
+  uint64_t sum = 0;
+  for(uint8_t i=0; i < THERMAL_BUCKETS; i++) {
+    sum += _thermal->charges[i];
+  }
+  return sum / _thermal->window;
+}
+
+/*
+ * Returns the thermal throttle's current scaling factor (255 = not throttled).
+ */
+uint8_t WS2812FX::getThrottle(void) {
+  return _thermal != NULL ? _thermal->throttle : 255;
+}
+
+/*
+ * Returns the estimated energy (Wh) used since the strip was powered up,
+ * or since the last call to resetEnergy().
+ */
+float WS2812FX::getEnergy(void) {
+  return ((float)_energy * _voltage) / 1000000000.0f;
+}
+
+void WS2812FX::resetEnergy(void) {
+  _charge = 0;
+  _energy = 0;
+}
+
+void WS2812FX::initPower(void) {
+  initOutput();
+  if(_segment_powers == NULL) {
+    _segment_powers = new segment_power[_segments_len]();
+    _power_time = millis();
+  }
+}
+
+/*
+ * Add the charge drawn since the last estimate to the energy total and the
+ * rolling window, then nudge the thermal throttle up or down depending on
+ * whether the average current is above or below the sustained limit.
+ */
+void WS2812FX::updateThermalModel(uint32_t elapsed) {
+  uint64_t charge = _charge + (uint64_t)_current * elapsed;
+  _energy += charge / 3600; // 3600 mA*ms = 1 uAh
+  _charge = charge % 3600;
+
+  if(_thermal == NULL) return;
+
+  // anything older than the window is dropped anyway
+  if(elapsed > _thermal->window) elapsed = _thermal->window;
+  uint32_t bucketLen = _thermal->window / THERMAL_BUCKETS;
+  _thermal->charges[_thermal->bucket] += (uint64_t)_current * elapsed;
+  _thermal->bucket_time += elapsed;
+  while(_thermal->bucket_time >= bucketLen) { // move on to the next sub-window
+    _thermal->bucket_time -= bucketLen;
+    _thermal->bucket = (_thermal->bucket + 1) % THERMAL_BUCKETS;
+    _thermal->charges[_thermal->bucket] = 0;
+    if(_thermal->bucket_time > _thermal->window) _thermal->bucket_time = bucketLen; // long pause, clear everything
+  }
+
+  // adjust the throttle by one step every THROTTLE_STEP_TIME ms. Don't
+  // release the throttle until the average is comfortably below the limit.
+  uint32_t average = getAverageCurrent();
+  uint32_t throttleTime = _thermal->throttle_time + elapsed;
+  _thermal->throttle_time = throttleTime % THROTTLE_STEP_TIME;
+  uint8_t steps = (uint8_t)min(throttleTime / THROTTLE_STEP_TIME, (uint32_t)255);
+
+  uint8_t throttle = _thermal->throttle;
+  if(average > _thermal->max_current) {
+    uint8_t lowest = _thermal->min_throttle;
+    throttle = throttle > lowest + steps ? throttle - steps : lowest;
+    if(throttle > lowest) _output_pending = true;
+  } else if(average < (uint32_t)(_thermal->max_current - (_thermal->max_current >> 4))) {
+    throttle = (255 - throttle) > steps ? throttle + steps : 255;
+    if(throttle < 255) _output_pending = true;
+  }
+  _thermal->throttle = throttle;
+}
+
+/*
+ * Update the energy estimates and, if the strip would draw more than the
+ * power budget, calculate a scaling factor for each segment.
+ * The budget is handed out in priority order, so high priority segments stay
+ * at full brightness while lower priority segments are dimmed. Segments that
+ * share a priority level are dimmed by the same amount.
+ */
+void WS2812FX::updatePowerBudget(void) {
+  if(numLEDs == 0) return;
+
+  // account for the energy used since the last estimate
+  unsigned long now = millis();
+  updateThermalModel(now - _power_time);
+  _power_time = now;
+
+  // the output stage has left each segment's demand (mA), not counting
+  // quiescent current, in the current field
+  uint32_t demand = 0;
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg != INACTIVE_SEGMENT) {
+      _segment_powers[seg].scale = 255;
+      demand += _segment_powers[seg].current;
+    }
+  }
+
+  uint32_t quiescent = ((uint32_t)numLEDs * _quiescent_current) / 1000;
+  uint32_t budget = _max_current > quiescent ? _max_current - quiescent : 0;
+
+  if(_max_current && demand > budget) {
+    // find the highest priority level that hasn't been processed yet, and give it
+    // as much of the remaining budget as it needs. Repeat for each lower level.
+    uint16_t level = 256;
+    while(true) {
+      int16_t priority = -1;
+      for(segment_id_t i=0; i < _active_segments_len; i++) {
+        segment_id_t seg = _active_segments[i];
+        if(seg != INACTIVE_SEGMENT && _segments[seg].priority < level && _segments[seg].priority > priority) {
+          priority = _segments[seg].priority;
+        }
+      }
+      if(priority < 0) break; // all priority levels processed
+
+      uint32_t levelDemand = 0;
+      for(segment_id_t i=0; i < _active_segments_len; i++) {
+        segment_id_t seg = _active_segments[i];
+        if(seg != INACTIVE_SEGMENT && _segments[seg].priority == priority) {
+          levelDemand += _segment_powers[seg].current;
+        }
+      }
+
+      uint8_t scale = 255;
+      if(levelDemand > budget) {
+        scale = (budget * 255) / levelDemand;
+        budget = 0;
+      } else {
+        budget -= levelDemand;
+      }
+
+      for(segment_id_t i=0; i < _active_segments_len; i++) {
+        segment_id_t seg = _active_segments[i];
+        if(seg != INACTIVE_SEGMENT && _segments[seg].priority == priority) {
+          _segment_powers[seg].scale = scale;
+        }
+      }
+      level = priority;
+    }
+  }
+
+  // the thermal throttle and power-on ramp dim all segments equally
+  uint16_t globalScale = (_thermal != NULL ? _thermal->throttle : 255) + 1;
+  if(_power_on_ramp && (now - _power_on_time) < _power_on_ramp) {
+    globalScale = (globalScale * ((now - _power_on_time) * 256 / _power_on_ramp)) >> 8;
+    _output_pending = true;
+  }
+
+  // convert demand into the current actually drawn after scaling
+  _current = quiescent;
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg != INACTIVE_SEGMENT) {
+      uint32_t scale = (_segment_powers[seg].scale + 1) * globalScale;
+      _segment_powers[seg].scale = scale ? (scale - 1) >> 8 : 0;
+      pixel_index_t segLen = _segments[seg].stop - _segments[seg].start + 1;
+      uint32_t current = (_segment_powers[seg].current * (_segment_powers[seg].scale + 1)) >> 8;
+      _segment_powers[seg].current = current + ((uint32_t)segLen * _quiescent_current) / 1000;
+      _current += current;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+  remap.cpp - WS2812FX LED remap functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // remapping is not supported on ATtiny devices
+
+/*
+ * Remap the pixel data to match the way the LEDs are wired. Effects render
+ * into a linear strip as usual, and the output stage rearranges the pixel data
+ * in one pass before it's sent to the LEDs, so serpentine layouts, reversed
+ * runs and unused LEDs don't need to be handled by the effects or a custom
+ * show function.
+ *
+ * The remap table holds the pixel shown on each LED: map[0] is the pixel
+ * shown on the first LED, map[1] on the second LED, and so on. LEDs mapped to
+ * REMAP_NONE are turned off, and LEDs past the end of the table show their own
+ * pixel. The table isn't copied, so it must stay in memory while it's in use.
+ * The table's 16-bit entries only reach the first 65535 LEDs and pixels, use
+ * a run-length encoded table for anything past that on longer strips.
+ */
+void WS2812FX::setRemap(const uint16_t map[], uint16_t len) {
+  initOutput();
+  _remap = map;
+  _remap_runs = NULL;
+  _remap_len = len;
+  _output_pending = true;
+}
+
+/*
+ * Large, regular layouts can use a run-length encoded remap table instead,
+ * where each run maps a number of LEDs to consecutive pixels (or to
+ * REMAP_RUN_NONE). For example, a serpentine matrix only needs one run per row.
+ * A run that starts past the end of the strip turns its LEDs off, so
+ * REMAP_NONE does too, on strips of up to 65535 LEDs.
+ */
+void WS2812FX::setRemap(const remap_run runs[], uint16_t numRuns) {
+  initOutput();
+  _remap = NULL;
+  _remap_runs = runs;
+  _remap_len = numRuns;
+  _output_pending = true;
+}
+
+void WS2812FX::removeRemap(void) {
+  _remap = NULL;
+  _remap_runs = NULL;
+  _remap_len = 0;
+  free(_map_pixels);
+  _map_pixels = NULL;
+  _output_pending = true;
+}
+
+/*
+ * Write the pixel data in src to dst, in the order of the remap table.
+ */
+void WS2812FX::remapOutput(const uint8_t* src, uint8_t* dst) {
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  pixel_index_t i = 0; // index of the LED being written
+
+  if(_remap != NULL) {
+    for(; i < _remap_len && i < numLEDs; i++) {
+      uint16_t n = _remap[i];
+      uint8_t* d = dst + i * bytesPerPixel;
+      if(n != REMAP_NONE && n < numLEDs) {
+        const uint8_t* s = src + n * bytesPerPixel;
+        for(uint8_t b=0; b < bytesPerPixel; b++) d[b] = s[b];
+      } else {
+        memset(d, 0, bytesPerPixel);
+      }
+    }
+  } else {
+    for(uint16_t k=0; k < _remap_len && i < numLEDs; k++) {
+      pixel_index_t start = _remap_runs[k].start;
+      pixel_index_t runLen = _remap_runs[k].len;
+      pixel_index_t len = runLen < numLEDs - i ? runLen : numLEDs - i; // runs are cut off at the end of the strip
+
+      if((_remap_runs[k].options & REVERSE) == REVERSE) {
+        for(pixel_index_t j=0; j < len; j++) {
+          pixel_index_t offset = runLen - 1 - j; // the LED's pixel is start + offset
+          uint8_t* d = dst + (i + j) * bytesPerPixel;
+          if(start < numLEDs && offset < numLEDs - start) {
+            const uint8_t* s = src + (start + offset) * bytesPerPixel;
+            for(uint8_t b=0; b < bytesPerPixel; b++) d[b] = s[b];
+          } else {
+            memset(d, 0, bytesPerPixel);
+          }
+        }
+      } else {
+        // the number of the run's LEDs that show a pixel, the rest are turned off
+        pixel_index_t valid = start < numLEDs ? (len < numLEDs - start ? len : numLEDs - start) : 0;
+        if(valid) memcpy(dst + i * bytesPerPixel, src + start * bytesPerPixel, valid * bytesPerPixel);
+        memset(dst + (i + valid) * bytesPerPixel, 0, (len - valid) * bytesPerPixel);
+      }
+      i += len;
+    }
+  }
+
+  // LEDs past the end of the remap table show their own pixel
+  memcpy(dst + i * bytesPerPixel, src + i * bytesPerPixel, (numLEDs - i) * bytesPerPixel);
+}
+
+#endif
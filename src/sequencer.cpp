@@ -0,0 +1,181 @@
+/*
+  sequencer.cpp - WS2812FX show cue functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // show cues are not supported on ATtiny devices
+
+/*
+ * Run a list of cues. Each cue is a set of segments, set up beforehand with
+ * setSegment() or setIdleSegment(), that run together for the cue's duration:
+ * a number of ms, or with the CUE_CYCLES option, a number of cycles of the
+ * cue's first segment. When a cue is done, service() switches to the next cue
+ * at the start of a frame, so the next cue's segments all start in the same
+ * frame. Segments in both cues keep running, the others are removed and added.
+ * After the last cue, the list starts over if loop is true, otherwise the
+ * last cue keeps running.
+ *
+ * A cue with a transition crossfades (or wipes, etc.) each of its new
+ * segments from the segment of the old cue that was running on the new
+ * segment's first LED. The transition buffers are allocated here, so
+ * switching cues doesn't allocate any memory. The cue list isn't copied,
+ * so it must stay in memory while it's in use.
+ */
+void WS2812FX::setCues(const show_cue cues[], uint8_t count, bool loop) {
+  if(count == 0) {
+    removeCues();
+    return;
+  }
+
+  _cues = cues;
+  _num_cues = count;
+  _service_cues = &WS2812FX::serviceCues;
+  _cue_loop = loop;
+  _cue = NO_CUE;
+  _next_cue = 0;
+
+  for(uint8_t i=0; i < count; i++) {
+    if(cues[i].transition) {
+      initTransitions();
+      break;
+    }
+  }
+}
+
+// stop running the cue list, the segments of the current cue keep running
+void WS2812FX::removeCues(void) {
+  _cues = NULL;
+  _num_cues = 0;
+  _cue = NO_CUE;
+  _next_cue = NO_CUE;
+}
+
+// switch to cue n at the next frame
+void WS2812FX::startCue(uint8_t n) {
+  if(n < _num_cues) _next_cue = n;
+}
+
+// switch to the next cue at the next frame, whether or not the current cue is done
+void WS2812FX::nextCue(void) {
+  if(_cues == NULL) return;
+  if(_cue == NO_CUE || _cue + 1 < _num_cues) {
+    _next_cue = _cue == NO_CUE ? 0 : _cue + 1;
+  } else if(_cue_loop) {
+    _next_cue = 0;
+  }
+}
+
+// returns the cue that's running, NO_CUE if there isn't one
+uint8_t WS2812FX::getCue(void) {
+  return _cue;
+}
+
+/*
+ * Called by service() before any segments run. Moves on to the next cue if
+ * the current cue is done, so the switch happens on a frame boundary.
+ */
+void WS2812FX::serviceCues(unsigned long now) {
+  unsigned long start = now;
+  if(_next_cue == NO_CUE && _cue != NO_CUE && _cues[_cue].duration != 0) {
+    const show_cue* cue = &_cues[_cue];
+    bool isDone;
+    if(cue->options & CUE_CYCLES) {
+      // a cycle flag set in the last service() call is still set, until the segment runs again
+      if(isCycle(cue->first)) _cue_cycles++;
+      isDone = _cue_cycles >= cue->duration;
+    } else {
+      isDone = now - _cue_time >= cue->duration;
+      // the next cue starts when this one was due to end, so cue times don't drift
+      if(isDone && now - _cue_time - cue->duration < cue->duration) start = _cue_time + cue->duration;
+    }
+
+    if(isDone) {
+      if(_cue + 1 < _num_cues) {
+        _next_cue = _cue + 1;
+      } else if(_cue_loop) {
+        _next_cue = 0;
+      }
+    }
+  }
+
+  if(_next_cue != NO_CUE) switchCue(_next_cue, start);
+}
+
+/*
+ * Swap the current cue's segments for cue n's segments. Segments that are in
+ * both cues keep their runtime, the new segments start from the beginning.
+ */
+void WS2812FX::switchCue(uint8_t n, unsigned long start) {
+  const show_cue* cue = &_cues[n];
+  segment_id_t first = cue->first;
+  segment_id_t last = (uint32_t)first + cue->count > _segments_len ? _segments_len : first + cue->count;
+
+  // put the leaving segments' pixel data back in order, the transitions start from it
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg != INACTIVE_SEGMENT && (seg < first || seg >= last)) unrollRing(seg, &_segment_runtimes[i]);
+  }
+
+  // the leaving segments become the outgoing effects of the new segments' transitions
+  if(cue->transition && _scratch_num_bytes == numBytes) {
+    for(segment_id_t seg=first; seg < last; seg++) {
+      if(isActiveSegment(seg) || _segments[seg].start >= numLEDs) continue;
+
+      pixel_index_t ledStart = _segments[seg].start;
+      for(segment_id_t i=0; i < _active_segments_len; i++) {
+        segment_id_t old = _active_segments[i];
+        if(old == INACTIVE_SEGMENT || (old >= first && old < last)) continue;
+        if(ledStart < _segments[old].start || ledStart > _segments[old].stop) continue;
+
+        startTransition(seg, cue->transition, cue->style);
+        _transitions[seg].fx = _segments[old];
+        _transitions[seg].rt = _segment_runtimes[i];
+        break;
+      }
+    }
+  }
+
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg != INACTIVE_SEGMENT && (seg < first || seg >= last)) setActiveSlot(i, INACTIVE_SEGMENT);
+  }
+  for(segment_id_t seg=first; seg < last; seg++) {
+    addActiveSegment(seg);
+  }
+
+  _cue = n;
+  _next_cue = NO_CUE;
+  _cue_cycles = 0;
+  _cue_time = start;
+}
+
+#endif
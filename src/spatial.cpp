@@ -0,0 +1,322 @@
+/*
+  spatial.cpp - WS2812FX spatial functions and effects
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // spatial effects are not supported on ATtiny devices
+
+#define NUM_BUCKETS (1 << (3 * SPATIAL_BUCKET_BITS))
+
+// the spatial index bucket of a coordinate, along one axis
+static inline uint8_t bucketOf(int16_t c) {
+  return (uint8_t)(constrain(c, -128, 127) + 128) >> (8 - SPATIAL_BUCKET_BITS);
+}
+
+static inline uint16_t bucketIndex(const WS2812FX::led_position& p) {
+  return (bucketOf(p.z) << (2 * SPATIAL_BUCKET_BITS)) | (bucketOf(p.y) << SPATIAL_BUCKET_BITS) | bucketOf(p.x);
+}
+
+/*
+ * Set the position of each LED, for installations that aren't strips or
+ * matrices (trees, domes, sculptures). Spatial effects light the LEDs by their
+ * positions instead of their index. Each coordinate is a signed 8-bit value,
+ * with -128 to 127 spanning the installation. The table isn't copied, so it
+ * must stay in memory while it's in use (on ESP32 boards a const table stays
+ * in flash memory). LEDs past the end of the table are at 0, 0, 0.
+ *
+ * A spatial index is built at the same time, which sorts the LEDs into
+ * buckets by position, so getNeighbors() only needs to look at LEDs that
+ * are close by.
+ */
+void WS2812FX::setPositions(const led_position positions[], uint16_t count) {
+  _positions = positions;
+  _num_positions = positions != NULL ? count : 0;
+
+  free(_bucket_starts);
+  free(_bucket_leds);
+  _bucket_starts = NULL;
+  _bucket_leds = NULL;
+  if(_num_positions == 0) return;
+
+  _bucket_starts = (uint16_t *)calloc(NUM_BUCKETS + 1, sizeof(uint16_t));
+  _bucket_leds = (uint16_t *)malloc(_num_positions * sizeof(uint16_t));
+  if(_bucket_starts == NULL || _bucket_leds == NULL) {
+    free(_bucket_starts);
+    free(_bucket_leds);
+    _bucket_starts = NULL;
+    _bucket_leds = NULL;
+    return;
+  }
+
+  // count the LEDs in each bucket, and work out where each bucket starts
+  for(uint16_t i=0; i < _num_positions; i++) {
+    _bucket_starts[bucketIndex(_positions[i])]++;
+  }
+  uint16_t start = 0;
+  for(uint16_t b=0; b <= NUM_BUCKETS; b++) {
+    uint16_t cnt = _bucket_starts[b];
+    _bucket_starts[b] = start;
+    start += cnt;
+  }
+
+  // sort the LEDs into buckets. Each bucket's start is moved along as its
+  // LEDs are added, so afterwards it's the start of the next bucket.
+  for(uint16_t i=0; i < _num_positions; i++) {
+    _bucket_leds[_bucket_starts[bucketIndex(_positions[i])]++] = i;
+  }
+  for(uint16_t b=NUM_BUCKETS; b > 0; b--) {
+    _bucket_starts[b] = _bucket_starts[b - 1];
+  }
+  _bucket_starts[0] = 0;
+}
+
+/*
+ * Set the direction the spatial sweep and wipe effects move in. The
+ * direction is a vector, with 127 being a whole unit along an axis. The
+ * default direction is 0, 127, 0 (along the y axis).
+ */
+void WS2812FX::setSpatialDirection(int8_t x, int8_t y, int8_t z) {
+  _spatial_dir.x = x;
+  _spatial_dir.y = y;
+  _spatial_dir.z = z;
+}
+
+WS2812FX::Led_position WS2812FX::getPosition(pixel_index_t n) {
+  led_position p = {0, 0, 0};
+  if(n < _num_positions) p = _positions[n];
+  return p;
+}
+
+/*
+ * Find the LEDs within radius of LED n (not including LED n itself). Up to
+ * max LED indexes are written to the neighbors array, and the number found is
+ * returned.
+ */
+uint16_t WS2812FX::getNeighbors(uint16_t n, uint8_t radius, uint16_t neighbors[], uint16_t max) {
+  if(_bucket_starts == NULL || n >= _num_positions) return 0;
+
+  led_position p = _positions[n];
+  uint8_t x0 = bucketOf(p.x - radius), x1 = bucketOf(p.x + radius);
+  uint8_t y0 = bucketOf(p.y - radius), y1 = bucketOf(p.y + radius);
+  uint8_t z0 = bucketOf(p.z - radius), z1 = bucketOf(p.z + radius);
+  uint16_t r2 = radius * radius;
+
+  uint16_t count = 0;
+  for(uint8_t bz=z0; bz <= z1; bz++) {
+    for(uint8_t by=y0; by <= y1; by++) {
+      for(uint8_t bx=x0; bx <= x1; bx++) {
+        uint16_t b = (bz << (2 * SPATIAL_BUCKET_BITS)) | (by << SPATIAL_BUCKET_BITS) | bx;
+        for(uint16_t k=_bucket_starts[b]; k < _bucket_starts[b + 1]; k++) {
+          uint16_t m = _bucket_leds[k];
+          if(m == n) continue;
+          int16_t dx = _positions[m].x - p.x, dy = _positions[m].y - p.y, dz = _positions[m].z - p.z;
+          if((uint32_t)(dx * dx + dy * dy + dz * dz) <= r2) {
+            if(count == max) return count;
+            neighbors[count++] = m;
+          }
+        }
+      }
+    }
+  }
+  return count;
+}
+
+/*
+ * The distance of an LED of the current segment along the spatial
+ * direction (-128 to 127).
+ */
+int16_t WS2812FX::spatialDepth(pixel_index_t i) {
+  led_position p = getPosition(i - _seg->start + _seg_origin);
+  int16_t d = ((int32_t)p.x * _spatial_dir.x + (int32_t)p.y * _spatial_dir.y + (int32_t)p.z * _spatial_dir.z) >> 7;
+  return constrain(d, -128, 127);
+}
+
+// integer square root
+static uint16_t isqrt(uint32_t n) {
+  uint32_t root = 0, bit = 1UL << 30;
+  while(bit > n) bit >>= 2;
+  while(bit) {
+    if(n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+// a pseudo random value for each point of the noise lattice
+static inline uint8_t latticeValue(int16_t x, int16_t y, int16_t z) {
+  uint32_t h = (uint32_t)x * 73856093UL ^ (uint32_t)y * 19349663UL ^ (uint32_t)z * 83492791UL;
+  h ^= h >> 13;
+  h *= 0x5bd1e995UL;
+  return (uint8_t)(h >> 15);
+}
+
+static inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t f) {
+  return a + ((((int16_t)b - a) * f) >> 8);
+}
+
+/*
+ * Smooth 3D value noise (0-255). The coordinates are 8.8 fixed point: the
+ * high byte is the lattice point, the low byte is the position between
+ * lattice points.
+ */
+static uint8_t noise3(int16_t x, int16_t y, int16_t z) {
+  int16_t ix = x >> 8, iy = y >> 8, iz = z >> 8;
+  uint8_t fx = x & 0xFF, fy = y & 0xFF, fz = z & 0xFF;
+  // ease the fractions, so the lattice doesn't show
+  fx = ((uint16_t)fx * fx >> 8) * (765 - 2 * fx) >> 8; // 3f^2 - 2f^3, roughly
+  fy = ((uint16_t)fy * fy >> 8) * (765 - 2 * fy) >> 8;
+  fz = ((uint16_t)fz * fz >> 8) * (765 - 2 * fz) >> 8;
+
+  uint8_t x00 = lerp8(latticeValue(ix, iy,     iz    ), latticeValue(ix + 1, iy,     iz    ), fx);
+  uint8_t x10 = lerp8(latticeValue(ix, iy + 1, iz    ), latticeValue(ix + 1, iy + 1, iz    ), fx);
+  uint8_t x01 = lerp8(latticeValue(ix, iy,     iz + 1), latticeValue(ix + 1, iy,     iz + 1), fx);
+  uint8_t x11 = lerp8(latticeValue(ix, iy + 1, iz + 1), latticeValue(ix + 1, iy + 1, iz + 1), fx);
+  return lerp8(lerp8(x00, x10, fy), lerp8(x01, x11, fy), fz);
+}
+
+/* #####################################################
+#
+#  Spatial effects
+#
+##################################################### */
+
+/*
+ * A plane of colors[0] sweeping back and forth through the installation,
+ * along the spatial direction, over a colors[1] background.
+ * The SIZE option sets the thickness of the plane.
+ */
+uint16_t WS2812FX::mode_plane_sweep(void) {
+  uint8_t step = _seg_rt->counter_mode_step;
+  int16_t plane = (step < 128 ? step * 2 : (255 - step) * 2) - 128;
+  uint16_t thickness = 8 << SIZE_OPTION;
+
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
+    uint16_t dist = abs(spatialDepth(i) - plane);
+    if(dist < thickness) {
+      setPixelColor(i, color_blend(_seg->colors[0], _seg->colors[1], (dist * 255) / thickness));
+    } else {
+      setPixelColor(i, _seg->colors[1]);
+    }
+  }
+
+  _seg_rt->counter_mode_step = (_seg_rt->counter_mode_step + 2) & 0xFF;
+  if(_seg_rt->counter_mode_step == 0) SET_CYCLE;
+  return (_seg->speed / 64);
+}
+
+/*
+ * Spheres of color expanding out from random LEDs. If colors[0] == colors[1],
+ * each sphere is a random color. The SIZE option sets the thickness of the
+ * spheres' shells.
+ */
+uint16_t WS2812FX::mode_spheres(void) {
+  if(_seg_rt->counter_mode_step == 0) { // start a new sphere
+    _seg_rt->aux_param3 = _seg->start + randomIndex(_seg_len);
+    _seg_rt->aux_param = random8();
+  }
+  bool isRandom = _seg->colors[0] == _seg->colors[1];
+  uint32_t color = isRandom ? color_wheel(_seg_rt->aux_param) : _seg->colors[0];
+  uint32_t bgColor = isRandom ? BLACK : _seg->colors[1];
+  led_position c = getPosition(_seg_rt->aux_param3 - _seg->start + _seg_origin);
+  uint16_t radius = _seg_rt->counter_mode_step * 2;
+  uint16_t thickness = 8 << SIZE_OPTION;
+
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
+    led_position p = getPosition(i - _seg->start + _seg_origin);
+    int16_t dx = p.x - c.x, dy = p.y - c.y, dz = p.z - c.z;
+    uint16_t dist = abs((int16_t)isqrt((int32_t)dx * dx + (int32_t)dy * dy + (int32_t)dz * dz) - (int16_t)radius);
+    if(dist < thickness) {
+      setPixelColor(i, color_blend(color, bgColor, (dist * 255) / thickness));
+    } else {
+      setPixelColor(i, bgColor);
+    }
+  }
+
+  // the sphere has left the installation once its radius is longer than the
+  // installation's diagonal
+  _seg_rt->counter_mode_step = (_seg_rt->counter_mode_step + 1) % 224;
+  if(_seg_rt->counter_mode_step == 0) SET_CYCLE;
+  return (_seg->speed / 64);
+}
+
+/*
+ * A slowly changing 3D noise field, blending colors[1] into colors[0].
+ * If colors[0] == colors[1], the noise field is a rainbow. The SIZE option
+ * sets the size of the noise field's features.
+ */
+uint16_t WS2812FX::mode_noise_field(void) {
+  uint8_t scale = 8 >> SIZE_OPTION; // number of noise lattice points across the installation
+  uint16_t t = _seg_rt->counter_mode_step;
+
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
+    led_position p = getPosition(i - _seg->start + _seg_origin);
+    uint8_t v = noise3((p.x + 128) * scale, (p.y + 128) * scale + t, (p.z + 128) * scale + (t >> 1));
+    if(_seg->colors[0] == _seg->colors[1]) {
+      setPixelColor(i, color_wheel(v));
+    } else {
+      setPixelColor(i, color_blend(_seg->colors[1], _seg->colors[0], v));
+    }
+  }
+
+  _seg_rt->counter_mode_step += 4;
+  if((_seg_rt->counter_mode_step & 0x3FF) == 0) SET_CYCLE;
+  return (_seg->speed / 64);
+}
+
+/*
+ * Wipe colors[0] through the installation along the spatial direction,
+ * then wipe colors[1].
+ */
+uint16_t WS2812FX::mode_spatial_wipe(void) {
+  int16_t edge = (int16_t)_seg_rt->counter_mode_step - 128;
+  uint32_t newColor = _seg->colors[_seg_rt->aux_param & 1];
+  uint32_t oldColor = _seg->colors[(_seg_rt->aux_param + 1) & 1];
+
+  for(pixel_index_t i=_seg->start; i <= _seg->stop; i++) {
+    setPixelColor(i, spatialDepth(i) < edge ? newColor : oldColor);
+  }
+
+  _seg_rt->counter_mode_step += 2;
+  if(_seg_rt->counter_mode_step > 256) { // past the end of the installation
+    _seg_rt->counter_mode_step = 0;
+    _seg_rt->aux_param++;
+    if((_seg_rt->aux_param & 1) == 0) SET_CYCLE;
+  }
+  return (_seg->speed / 64);
+}
+
+#endif
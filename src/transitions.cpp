@@ -0,0 +1,171 @@
+/*
+  transitions.cpp - WS2812FX segment transition functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+  2026-10-19   Added automatic transitions
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // transitions are not supported on ATtiny devices
+
+/*
+ * Start a transition on a segment. The segment's current effect keeps running
+ * in the background, and is mixed with whatever the segment is changed to
+ * (by setMode(), setColor(), setSegment(), etc.) over the transition's
+ * duration (ms). The style is one of the TRANSITION_* values, optionally
+ * combined with an EASE_* value, e.g. TRANSITION_WIPE | EASE_IN_OUT.
+ * The direction of wipe and push transitions follows the segment's REVERSE
+ * option.
+ *
+ * All transitions share one scratch buffer the size of the strip's pixel
+ * data, and the mixing is only done for segments that are in transition.
+ */
+void WS2812FX::startTransition(segment_id_t seg, uint16_t duration, uint8_t style) {
+  if(seg >= _segments_len || duration == 0) return;
+  if(!initTransitions() || _segments[seg].start >= numLEDs) return;
+
+  // the outgoing effect carries on from where it is now, with its current pixel data
+  segment_transition* trans = &_transitions[seg];
+  trans->fx = _segments[seg];
+  segment_id_t slot = activeSlot(seg);
+  if(slot != INACTIVE_SEGMENT) {
+    trans->rt = _segment_runtimes[slot];
+    trans->next_time = _next_times[slot];
+  } else {
+    trans->rt = segment_runtime();
+    trans->next_time = 0;
+  }
+
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+  pixel_index_t start = _segments[seg].start * bytesPerPixel;
+  memcpy(_scratch_pixels + start, pixels + start, (stop + 1) * bytesPerPixel - start);
+
+  trans->start_time = millis();
+  trans->duration = duration;
+  trans->style = style;
+  trans->shown = false;
+}
+
+/*
+ * Allocate the transitions array and the scratch buffer, if they haven't been
+ * already. Returns false if there isn't enough memory for the scratch buffer.
+ */
+bool WS2812FX::initTransitions(void) {
+  initOutput();
+  if(_transitions == NULL) _transitions = new segment_transition[_segments_len]();
+  _service_transitions = &WS2812FX::serviceTransitions;
+  if(_scratch_num_bytes != numBytes) {
+    free(_scratch_pixels);
+    _scratch_pixels = allocBuffer(numBytes, PSRAM_BUFFERS);
+    _scratch_num_bytes = _scratch_pixels != NULL ? numBytes : 0;
+  }
+  return _scratch_pixels != NULL;
+}
+
+/*
+ * Enable automatic transitions on a segment. Changing the segment's mode,
+ * colors or options starts a transition, and speed changes are ramped over
+ * the transition's duration. Setting the duration to zero disables automatic
+ * transitions.
+ */
+void WS2812FX::setAutoTransition(segment_id_t seg, uint16_t duration, uint8_t style) {
+  if(seg >= _segments_len) return;
+
+  initOutput();
+  if(_transitions == NULL) _transitions = new segment_transition[_segments_len]();
+  _service_transitions = &WS2812FX::serviceTransitions;
+  _auto_transition = &WS2812FX::autoTransition;
+  _transitions[seg].auto_duration = duration;
+  _transitions[seg].auto_style = style;
+}
+
+void WS2812FX::autoTransition(segment_id_t seg) {
+  if(_transitions == NULL || _transitions[seg].auto_duration == 0 || !_running) return;
+
+  // several changes in a row (setMode() then setColor(), for example) are
+  // all part of the transition that hasn't been shown yet
+  if(_transitions[seg].duration != 0 && !_transitions[seg].shown) return;
+
+  startTransition(seg, _transitions[seg].auto_duration, _transitions[seg].auto_style);
+}
+
+bool WS2812FX::isTransitioning(segment_id_t seg) {
+  return _transitions != NULL && seg < _segments_len && _transitions[seg].duration != 0;
+}
+
+/*
+ * Run the outgoing effect of each segment in transition, and end the
+ * transitions that are done. Returns true if the LEDs need to be updated.
+ */
+bool WS2812FX::serviceTransitions(unsigned long now) {
+  bool doShow = false;
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(segment_id_t i=0; i < _active_segments_len; i++) {
+    segment_id_t seg = _active_segments[i];
+    if(seg == INACTIVE_SEGMENT) continue;
+
+    // ramp the speed
+    segment_transition* trans = &_transitions[seg];
+    if(trans->to_speed) {
+      uint32_t elapsed = now - trans->speed_time;
+      if(elapsed >= trans->auto_duration) {
+        _segments[seg].speed = trans->to_speed;
+        trans->to_speed = 0;
+      } else {
+        _segments[seg].speed = trans->from_speed + ((int32_t)(trans->to_speed - trans->from_speed) * (int32_t)elapsed) / trans->auto_duration;
+      }
+    }
+
+    if(trans->duration == 0) continue;
+    if(now - trans->start_time >= trans->duration || _scratch_num_bytes != numBytes || _segments[seg].start >= numLEDs) {
+      trans->duration = 0; // transition done (or the strip has changed length, so cancel it)
+      doShow = true;
+      continue;
+    }
+
+    _output_pending = true; // the mix changes over time, so keep the LEDs updated
+    if(now > trans->next_time || _triggered) {
+      pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+      pixel_index_t len = stop - _segments[seg].start + 1;
+      uint8_t* buf = _scratch_pixels + _segments[seg].start * bytesPerPixel;
+      _seg_matrix = _matrices != NULL ? &_matrices[seg] : NULL;
+      _seg_origin = _segments[seg].start;
+      _seg_scale = segmentScale(seg);
+      uint16_t delay = renderShadow(&trans->fx, &trans->rt, buf, len);
+      trans->next_time = now + (delay > SPEED_MIN ? delay : SPEED_MIN);
+      trans->rt.counter_mode_call++;
+      doShow = true;
+    }
+  }
+  return doShow;
+}
+
+#endif
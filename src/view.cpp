@@ -0,0 +1,193 @@
+/*
+  view.cpp - WS2812FX segment view functions
+
+  LICENSE
+
+  The MIT License (MIT)
+
+  Copyright (c) 2016  Harm Aldick
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+  THE SOFTWARE.
+
+
+  CHANGELOG
+
+  2026-10-19   Initial version
+*/
+#include "WS2812FX.h"
+
+#if !defined(MEGATINYCORE) // view transforms are not supported on ATtiny devices
+
+/*
+ * Run the current segment's mode, applying the segment's view transforms.
+ * With a render scale, the mode renders a segment 1/scale the length, packed
+ * into the start of the segment, and the output stage stretches it back out
+ * over the segment's LEDs.
+ * With the MIRROR option, the mode only renders the first half of the
+ * segment (so it only does half the work), and the first half is then copied
+ * to the second half, mirrored about the segment's center.
+ */
+uint16_t WS2812FX::runMode(void) {
+  if(!IS_MIRROR && _seg_scale < 2) return (MODE_PTR(_seg->mode))();
+
+  pixel_index_t stop = _seg->stop;
+  pixel_index_t len = _seg_len;
+  if(_seg_scale > 1) {
+    _seg_len = (len + _seg_scale - 1) / _seg_scale;
+    _seg->stop = _seg->start + _seg_len - 1;
+  }
+  if(!IS_MIRROR) {
+    uint16_t delay = (MODE_PTR(_seg->mode))();
+    _seg->stop = stop;
+    _seg_len = len;
+    return delay;
+  }
+
+  pixel_index_t viewStop = _seg->stop;
+  pixel_index_t viewLen = _seg_len;
+  _seg_len = (viewLen + 1) / 2;
+  _seg->stop = _seg->start + _seg_len - 1;
+
+  uint16_t delay = (MODE_PTR(_seg->mode))();
+
+  _seg->stop = stop;
+  _seg_len = len;
+
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  for(pixel_index_t i=0; i < viewLen / 2; i++) {
+    if(viewStop - i < numLEDs) {
+      memcpy(pixels + (viewStop - i) * bytesPerPixel, pixels + (_seg->start + i) * bytesPerPixel, bytesPerPixel);
+    }
+  }
+  return delay;
+}
+
+/*
+ * Rotate a segment by a number of LEDs, so the LED at the segment's start is
+ * shown offset LEDs further along (wrapping around at the segment's end).
+ * The offset is applied by the output stage, so the effect's own pixel data
+ * isn't changed, and effects don't need to know about it. Useful for rings,
+ * where the first LED isn't where the effect should start.
+ */
+void WS2812FX::setSegmentOffset(segment_id_t seg, pixel_index_t offset) {
+  initOutput();
+  _segments[seg].offset = offset;
+  _output_pending = true;
+}
+
+pixel_index_t WS2812FX::getSegmentOffset(segment_id_t seg) {
+  return _segments[seg].offset;
+}
+
+/*
+ * Render a segment at a reduced resolution. The segment's effect (and its
+ * layers and transitions) only renders one pixel for every factor LEDs, and
+ * the output stage upsamples the rendered pixels to the segment's LEDs, either
+ * repeating each pixel (SCALE_NEAREST) or interpolating between neighbouring
+ * pixels (SCALE_LINEAR). Set factor to 1 to render at full resolution again.
+ * Matrix segments always render at full resolution.
+ */
+void WS2812FX::setSegmentScale(segment_id_t seg, uint8_t factor, uint8_t options) {
+  if(seg >= _segments_len) return;
+
+  if(_scales == NULL) {
+    if(factor < 2) return;
+    _scales = (uint8_t *)malloc(_segments_len);
+    if(_scales == NULL) return;
+    memset(_scales, 1, _segments_len);
+  }
+
+  initOutput();
+  factor = constrain(factor, 1, 127);
+  _scales[seg] = factor | (factor > 1 ? options & SCALE_LINEAR : 0);
+  _triggered = true;
+}
+
+uint8_t WS2812FX::getSegmentScale(segment_id_t seg) {
+  return (_scales != NULL && seg < _segments_len) ? _scales[seg] & ~SCALE_LINEAR : 1;
+}
+
+// the render scale the segment's effects actually run at
+uint8_t WS2812FX::segmentScale(segment_id_t seg) {
+  if(_scales == NULL) return 1;
+  if(_matrices != NULL && _matrices[seg].width) return 1;
+  return _scales[seg] & ~SCALE_LINEAR;
+}
+
+// reverse the order of count pixels, in place
+static void reversePixels(uint8_t* p, pixel_index_t count, uint8_t bytesPerPixel) {
+  if(count < 2) return;
+  uint8_t* left  = p;
+  uint8_t* right = p + (count - 1) * bytesPerPixel;
+  while(left < right) {
+    for(uint8_t b=0; b < bytesPerPixel; b++) {
+      uint8_t tmp = left[b];
+      left[b] = right[b];
+      right[b] = tmp;
+    }
+    left += bytesPerPixel;
+    right -= bytesPerPixel;
+  }
+}
+
+/*
+ * Rotate a segment's pixel data back into place, if an effect left it rotated
+ * by scrolling with shiftPixels(), so the next effect starts from the pixels
+ * as they were shown. Rotating left by n is the same as reversing the first n
+ * and the last len - n pixels separately, then reversing the whole ring.
+ * Effects running at a reduced scale only fill the start of the segment, so
+ * the ring is the scaled length, the same as the output stage uses.
+ */
+void WS2812FX::unrollRing(segment_id_t seg, segment_runtime* rt) {
+  pixel_index_t head = rt->head;
+  rt->head = 0;
+  if(head == 0 || _segments[seg].start >= numLEDs) return;
+
+  uint8_t factor = segmentScale(seg);
+  pixel_index_t segLen = _segments[seg].stop + 1 - _segments[seg].start;
+  pixel_index_t stop = _segments[seg].stop < numLEDs ? _segments[seg].stop : numLEDs - 1;
+  pixel_index_t ringLen = (segLen + factor - 1) / factor;
+  pixel_index_t len = (stop + 1 - _segments[seg].start + factor - 1) / factor; // the part of the ring on the strip
+  head %= ringLen;
+  if(head == 0) return;
+
+  uint8_t bytesPerPixel = getNumBytesPerPixel(); // 3=RGB, 4=RGBW
+  uint8_t* p = pixels + _segments[seg].start * bytesPerPixel;
+  if(len == ringLen) {
+    reversePixels(p, head, bytesPerPixel);
+    reversePixels(p + head * bytesPerPixel, len - head, bytesPerPixel);
+    reversePixels(p, len, bytesPerPixel);
+    return;
+  }
+
+  // the ring runs past the strip's end, so move each pixel the output stage
+  // shows to where it was shown, the pixels off the strip are lost anyway
+  uint8_t* tmp = (uint8_t *)malloc(len * bytesPerPixel);
+  if(tmp == NULL) return;
+  for(pixel_index_t n=0; n < len; n++) {
+    uint32_t src = (uint32_t)n + head;
+    if(src >= ringLen) src -= ringLen;
+    if(src >= len) src = n;
+    memcpy(tmp + n * bytesPerPixel, p + src * bytesPerPixel, bytesPerPixel);
+  }
+  memcpy(p, tmp, len * bytesPerPixel);
+  free(tmp);
+}
+
+#endif